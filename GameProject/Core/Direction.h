@@ -10,3 +10,12 @@ enum class Direction {
     RIGHT,
     STAY
 };
+
+// True if one direction is horizontal and the other vertical
+inline bool isPerpendicularDirection(Direction a, Direction b) {
+    bool aHorizontal = (a == Direction::LEFT || a == Direction::RIGHT);
+    bool aVertical = (a == Direction::UP || a == Direction::DOWN);
+    bool bHorizontal = (b == Direction::LEFT || b == Direction::RIGHT);
+    bool bVertical = (b == Direction::UP || b == Direction::DOWN);
+    return (aHorizontal && bVertical) || (aVertical && bHorizontal);
+}
@@ -0,0 +1,31 @@
+// EventBus.cpp - Consumer registry and batch dispatch
+
+#include "EventBus.h"
+#include <algorithm>
+
+void EventBus::subscribe(EventConsumer* consumer, StepEventMask interests) {
+    if (!consumer) return;
+    for (auto& sub : subscriptions) {
+        if (sub.consumer == consumer) {
+            sub.interests = interests;
+            return;
+        }
+    }
+    subscriptions.push_back(Subscription(consumer, interests));
+}
+
+void EventBus::unsubscribe(EventConsumer* consumer) {
+    subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(),
+        [consumer](const Subscription& sub) { return sub.consumer == consumer; }),
+        subscriptions.end());
+}
+
+// Subscribers are called in subscription order; a consumer whose interests miss
+// every type in the batch is skipped without looking at the events
+void EventBus::dispatch(const StepEvents& events) const {
+    StepEventMask types = events.getTypes();
+    if (types == 0) return;
+    for (const auto& sub : subscriptions) {
+        if (sub.interests & types) sub.consumer->onEvents(events);
+    }
+}
@@ -0,0 +1,37 @@
+// EventBus.h - Batched dispatch of step events to registered consumers
+// Gameplay only appends typed StepEvents during a tick; afterwards the whole batch is
+// handed to each consumer (recorder, console, stats...) whose interests overlap the
+// types in it. Nothing is formatted or dispatched for a consumer that is not subscribed.
+
+#pragma once
+
+#include "LevelStep.h"
+#include <vector>
+
+class EventConsumer {
+public:
+    virtual ~EventConsumer() = default;
+
+    // Called once per batch; the consumer picks the events it cares about
+    virtual void onEvents(const StepEvents& events) = 0;
+};
+
+class EventBus {
+private:
+    struct Subscription {
+        EventConsumer* consumer;
+        StepEventMask interests;
+
+        Subscription(EventConsumer* c, StepEventMask m) : consumer(c), interests(m) {}
+    };
+    std::vector<Subscription> subscriptions;
+
+public:
+    static const StepEventMask ALL_EVENTS = ~StepEventMask(0);
+
+    // Re-subscribing a consumer replaces its interests
+    void subscribe(EventConsumer* consumer, StepEventMask interests = ALL_EVENTS);
+    void unsubscribe(EventConsumer* consumer);
+
+    void dispatch(const StepEvents& events) const;
+};
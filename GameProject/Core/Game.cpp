@@ -7,6 +7,7 @@
 #include "ScreenParser.h"
 #include "StatusBar.h"
 #include "MessageDisplay.h"
+#include <algorithm>
 #include <cctype>
 #include <iostream>
 
@@ -21,6 +22,8 @@ Game::Game()
     isRunning(true),
     noScreenFilesFound(false) {
     recorder.setMode(GameMode::Normal);
+    recorder.initializeRandomSeed();
+    random.setState(recorder.getRandomState());
     ScreenParser::setRecorder(&recorder);
     initScreens();
 }
@@ -36,6 +39,9 @@ Game::Game(GameMode mode)
     isRunning(true),
     noScreenFilesFound(false) {
     recorder.setMode(mode);
+    if (mode != GameMode::Normal) {
+        eventBus.subscribe(&recorder, GameRecorder::RECORDED_EVENTS);
+    }
     
     // Set silent mode globally for rendering classes
     Player::setSilentMode(recorder.isSilentMode());
@@ -45,14 +51,14 @@ Game::Game(GameMode mode)
     // Set the recorder in ScreenParser so it can access riddle questions
     ScreenParser::setRecorder(&recorder);
     
-    // In load mode, load the steps file FIRST to get the random seed and riddle questions
+    // In load mode, load the steps file FIRST to get the random state and riddle questions
     // This ensures riddles are selected the same way as during recording
     if (mode == GameMode::Load || mode == GameMode::LoadSilent) {
-        if (recorder.loadStepsFile()) {
-            // Apply the seed before loading levels
-            recorder.setRandomSeed(recorder.getRandomSeed());
-        }
+        recorder.loadStepsFile();
+    } else {
+        recorder.initializeRandomSeed();
     }
+    random.setState(recorder.getRandomState());
     
     initScreens();
 }
@@ -71,6 +77,7 @@ void Game::initScreens() {
 // and extracts player start positions from the first level.
 void Game::initGameLevels() {
     ScreenParser parser;
+    backgroundRooms.clear();
 
     // Find all adv-world_XX.screen files in sorted order
     std::vector<std::string> screenFiles = ScreenParser::discoverScreenFiles();
@@ -92,6 +99,7 @@ void Game::initGameLevels() {
         if (level) {
             level->setPlayers(&player1, &player2);
             level->setGame(this);
+            level->setRandom(&random);
             level->setSilentMode(recorder.isSilentMode());
             level->init();
             gameLevels.push_back(std::move(level));
@@ -121,6 +129,7 @@ void Game::initGameLevels() {
 void Game::createVictoryLevel() {
     auto level = std::make_unique<GameLevel>(3);
     level->setPlayers(&player1, &player2);
+    level->setRandom(&random);
     level->setSilentMode(recorder.isSilentMode());
     level->init();
     gameLevels.push_back(std::move(level));
@@ -137,6 +146,16 @@ void Game::resetPlayers() {
     player2.disposeItem();
 }
 
+// Pin the generator for a new game: playback restores the recorded state,
+// other modes record the state this game starts from
+void Game::startRandomSession() {
+    if (recorder.isLoadMode()) {
+        random.setState(recorder.getRandomState());
+    } else {
+        recorder.setRandomState(random.getState());
+    }
+}
+
 // AI-assisted: Handle screen transitions and game flow
 // Processes level completion, door targets for non-linear level order,
 // game over, victory, and menu navigation. Door target system allows
@@ -170,6 +189,7 @@ void Game::handleScreenResult(ScreenResult result) {
         }
 
         // Fresh start - reload everything
+        preloader.cancel();
         gameLevels.clear();
         ScreenParser::resetRiddleIndex();  // Reset riddle counter for new game
         initGameLevels();
@@ -181,6 +201,8 @@ void Game::handleScreenResult(ScreenResult result) {
         LivesManager::resetCoins();
         resetPlayers();
         recorder.resetCycle();
+        startRandomSession();
+        preloadDoorTargets();
         
         if (!recorder.isSilentMode()) {
             clrscr();
@@ -193,6 +215,7 @@ void Game::handleScreenResult(ScreenResult result) {
 
     case ScreenResult::NextScreen: {
         // Get the door's target screen from the current level
+        int leftIndex = currentLevelIndex;
         int targetScreen = gameLevels[currentLevelIndex]->getDoorTargetScreen();
         
         // Target is 1-based (target: 1 = adv-world_01.screen), convert to 0-based index
@@ -203,20 +226,43 @@ void Game::handleScreenResult(ScreenResult result) {
             currentLevelIndex++;
         }
         
-        // Record screen transition (use level index + 1 for 1-based screen number)
-        recorder.recordScreenChange(0, currentLevelIndex + 1);
+        // A room left with something still going on keeps running without the players
+        GameLevel& leftLevel = *gameLevels[leftIndex];
+        if (leftLevel.hasPendingActivity()) {
+            leftLevel.leave();
+            auto at = std::lower_bound(backgroundRooms.begin(), backgroundRooms.end(), leftIndex);
+            if (at == backgroundRooms.end() || *at != leftIndex) backgroundRooms.insert(at, leftIndex);
+        }
+        
+        // Screen transition (level index + 1 is the 1-based screen number)
+        flowEvents.push(StepEvent(StepEventType::ScreenChanged, 0, Point(), currentLevelIndex + 1));
 
         // Check if we beat all levels
         if (currentLevelIndex >= (int)gameLevels.size() - 1) {
             currentState = GameState::Victory;
-            recorder.recordGameEnd(LivesManager::getCoins(), true);
+            flowEvents.push(StepEvent(StepEventType::GameEnded, 0, Point(), LivesManager::getCoins(), 1));
         }
         else {
-            // Reset the target level (restores objects, doors, etc.)
-            gameLevels[currentLevelIndex]->reset();
+            // Reset the target level (restores objects, doors, etc.), unless it was
+            // left running: then the players find it as the background steps left it,
+            // whether it is still running or has settled since
+            GameLevel& target = *gameLevels[currentLevelIndex];
+            preloader.claim(&target);
+            if (target.isDetached()) {
+                backgroundRooms.erase(std::remove(backgroundRooms.begin(), backgroundRooms.end(),
+                    currentLevelIndex), backgroundRooms.end());
+                target.resume();
+            } else if (target.isPrepared()) {
+                target.enterPrepared();
+            } else {
+                target.reset();
+            }
             resetPlayers();
+            preloadDoorTargets();
             // Note: clrscr() is called in enter(), no need to call it here
         }
+        eventBus.dispatch(flowEvents);
+        flowEvents.clear();
         break;
     }
 
@@ -229,6 +275,7 @@ void Game::handleScreenResult(ScreenResult result) {
         std::string filename = loadGameScreen->getSelectedFilename();
         if (!filename.empty() && loadFromSaveFile(filename)) {
             currentState = GameState::Playing;
+            preloadDoorTargets();
             if (!recorder.isSilentMode()) {
                 clrscr();
             }
@@ -249,7 +296,9 @@ void Game::handleScreenResult(ScreenResult result) {
         break;
 
     case ScreenResult::GameOver:
-        recorder.recordGameEnd(LivesManager::getCoins(), false);
+        flowEvents.push(StepEvent(StepEventType::GameEnded, 0, Point(), LivesManager::getCoins(), 0));
+        eventBus.dispatch(flowEvents);
+        flowEvents.clear();
         
         if (!recorder.isSilentMode()) {
             clrscr();
@@ -288,7 +337,8 @@ void Game::handleScreenResult(ScreenResult result) {
 }
 
 // Run game loop for current active screen based on state
-void Game::runCurrentScreen() {
+// (render = false for catch-up ticks: the state advances but nothing is drawn)
+void Game::runCurrentScreen(bool render) {
     BaseScreen* currentScreen = nullptr;
 
     switch (currentState) {
@@ -325,56 +375,132 @@ void Game::runCurrentScreen() {
         // Standard game loop
         currentScreen->handleInput();
         currentScreen->update();
+        if (currentState == GameState::Playing && !backgroundRooms.empty() &&
+            !gameLevels[currentLevelIndex]->isPaused()) {
+            updateBackgroundRooms();
+        }
         
-        if (!recorder.isSilentMode()) {
+        if (render && !recorder.isSilentMode()) {
             currentScreen->render();
+            latency.framePresented();
         }
 
         // Check if screen wants to transition
         ScreenResult result = currentScreen->getResult();
         if (result != ScreenResult::None) {
             currentScreen->exit();
+            keyboard.stop();  // Transition screens read the console directly
+            latency.discardPending();
             handleScreenResult(result);
         }
     }
 }
 
+// Print how often the loop fell behind its tick deadlines (nothing when it never did)
+void Game::reportTickOverruns(const TickScheduler& ticks) const {
+    if (ticks.getOverruns() == 0) return;
+    std::cout << "Timing: " << ticks.getOverruns() << " tick overrun(s), worst "
+              << ticks.getWorstLateMs() << " ms late, " << ticks.getSkippedTicks()
+              << " tick(s) skipped" << std::endl;
+}
+
+// Keypress-to-screen latency: summary on the console, full samples in a file
+void Game::reportLatency() const {
+    if (latency.getSampleCount() == 0) return;
+    latency.printSummary();
+    if (latency.saveReport()) {
+        std::cout << "Latency samples saved to " << LatencyTracker::REPORT_FILE << std::endl;
+    }
+}
+
+// Step every background room once, after the current room and in level order, so
+// recording and playback see the same sequence. A room that has settled drops out,
+// costs nothing and keeps its settled state until the players come back.
+// (Background rooms share nothing but read-only settings, so they could be stepped in
+// parallel; at a handful of timers per room a thread hand-off would cost more.)
+void Game::updateBackgroundRooms() {
+    for (size_t i = 0; i < backgroundRooms.size();) {
+        GameLevel& room = *gameLevels[backgroundRooms[i]];
+        room.stepBackground();
+        if (room.hasPendingActivity()) i++;
+        else backgroundRooms.erase(backgroundRooms.begin() + i);
+    }
+}
+
+// Hand the levels the current level's doors lead to (not the final screen, which is
+// never reset, nor rooms left running in the background, settled or not) to the preloader
+void Game::preloadDoorTargets() {
+    if (currentLevelIndex < 0 || currentLevelIndex >= (int)gameLevels.size()) return;
+    int lastIndex = (int)gameLevels.size() - 1;
+
+    std::vector<GameLevel*> targets;
+    for (int screen : gameLevels[currentLevelIndex]->getDoorTargetScreens()) {
+        int index = (screen >= 1 && screen <= (int)gameLevels.size()) ? screen - 1 : currentLevelIndex + 1;
+        if (index == currentLevelIndex || index >= lastIndex) continue;
+
+        GameLevel* level = gameLevels[index].get();
+        if (level->isDetached() || level->isPrepared()) continue;
+        if (std::find(targets.begin(), targets.end(), level) == targets.end()) targets.push_back(level);
+    }
+    if (!targets.empty()) preloader.request(targets);
+}
+
 // Run interactive gameplay mode
 void Game::runNormalMode() {
     hideCursor();
+    TickScheduler ticks(GameConfig::GAME_CYCLE_MS, GameConfig::MAX_CATCH_UP_CYCLES);
 
     while (isRunning) {
-        runCurrentScreen();
+        // Menus wait for keys; only gameplay is paced and fed by the keyboard thread
+        if (currentState != GameState::Playing) {
+            keyboard.stop();
+            runCurrentScreen();
+            ticks.reset();
+            continue;
+        }
+        keyboard.start();
 
-        // Slow down gameplay to playable speed
-        if (currentState == GameState::Playing) {
-            Sleep(GameConfig::GAME_CYCLE_MS);
+        // Catch-up ticks run unrendered; only the last one of a batch is drawn
+        int due = ticks.waitForTicks();
+        for (int i = 0; i < due && isRunning && currentState == GameState::Playing; i++) {
+            runCurrentScreen(i == due - 1);
         }
     }
+    keyboard.stop();
 
     // Goodbye message
     clrscr();
     showCursor();
     gotoxy(0, 0);
     std::cout << "Thanks for playing Text Adventure World!" << std::endl;
+    reportTickOverruns(ticks);
+    reportLatency();
 }
 
 // Run in recording mode - saves all inputs to steps file
 void Game::runSaveMode() {
     hideCursor();
-    
-    // Initialize random seed and record it
-    recorder.initializeRandomSeed();
+    TickScheduler ticks(GameConfig::GAME_CYCLE_MS, GameConfig::MAX_CATCH_UP_CYCLES);
 
     while (isRunning) {
-        runCurrentScreen();
-
-        // Increment cycle counter when playing
-        if (currentState == GameState::Playing) {
-            recorder.nextCycle();
-            Sleep(GameConfig::GAME_CYCLE_MS);
+        if (currentState != GameState::Playing) {
+            keyboard.stop();
+            runCurrentScreen();
+            ticks.reset();
+            continue;
+        }
+        keyboard.start();
+
+        // Every tick is one recorded cycle, rendered or not
+        int due = ticks.waitForTicks();
+        for (int i = 0; i < due && isRunning && currentState == GameState::Playing; i++) {
+            runCurrentScreen(i == due - 1);
+            if (currentState == GameState::Playing) {
+                recorder.nextCycle();
+            }
         }
     }
+    keyboard.stop();
 
     // Save files when done
     recorder.saveStepsFile();
@@ -388,6 +514,8 @@ void Game::runSaveMode() {
     gotoxy(0, 0);
     std::cout << "Thanks for playing Text Adventure World!" << std::endl;
     std::cout << "Game recorded to adv-world.steps and adv-world.result" << std::endl;
+    reportTickOverruns(ticks);
+    reportLatency();
 }
 
 // Run in playback mode - replays from recorded steps and verifies results
@@ -423,9 +551,6 @@ void Game::runLoadMode() {
         }
     }
     
-    // Set random seed from file
-    recorder.setRandomSeed(recorder.getRandomSeed());
-    
     if (!recorder.isSilentMode()) {
         hideCursor();
     }
@@ -437,27 +562,31 @@ void Game::runLoadMode() {
     LivesManager::resetCoins();
     resetPlayers();
     recorder.resetCycle();  // Ensure cycle counter starts at 0
+    startRandomSession();   // Restore recorded generator state
     
     // Clear and redraw for initial state
     if (!recorder.isSilentMode()) {
         clrscr();
     }
 
-    while (isRunning && currentState == GameState::Playing) {
-        runCurrentScreen();
-        recorder.nextCycle();
+    // In silent mode, run as fast as possible
+    // In visual load mode, pace at double speed (faster playback)
+    TickScheduler ticks(GameConfig::GAME_CYCLE_MS / 2, GameConfig::MAX_CATCH_UP_CYCLES);
+    bool stepsExhausted = false;
 
-        // In silent mode, run as fast as possible
-        // In visual load mode, use shorter delay
-        if (!recorder.isSilentMode()) {
-            Sleep(GameConfig::GAME_CYCLE_MS / 2);  // Faster playback
-        }
-        
-        // Safety: Exit if all steps processed and game hasn't naturally ended
-        // In silent mode, use a shorter buffer since we want fast results
-        int safetyBuffer = recorder.isSilentMode() ? 10 : 30;
-        if (!recorder.hasNextStep() && recorder.getCurrentCycle() > recorder.getLastStepCycle() + safetyBuffer) {
-            break;
+    while (isRunning && currentState == GameState::Playing && !stepsExhausted) {
+        int due = recorder.isSilentMode() ? 1 : ticks.waitForTicks();
+        for (int i = 0; i < due && isRunning && currentState == GameState::Playing; i++) {
+            runCurrentScreen(i == due - 1);
+            recorder.nextCycle();
+
+            // Safety: Exit if all steps processed and game hasn't naturally ended
+            // In silent mode, use a shorter buffer since we want fast results
+            int safetyBuffer = recorder.isSilentMode() ? 10 : 30;
+            if (!recorder.hasNextStep() && recorder.getCurrentCycle() > recorder.getLastStepCycle() + safetyBuffer) {
+                stepsExhausted = true;
+                break;
+            }
         }
     }
     
@@ -519,6 +648,11 @@ bool Game::saveCurrentState() {
     state.player2Y = player2.getPosition().getY();
     state.player2Item = player2.getHeldItem();
     
+    // Fog of war of the current level
+    if (currentLevelIndex >= 0 && currentLevelIndex < (int)gameLevels.size()) {
+        state.exploredRows = gameLevels[currentLevelIndex]->getExploredRows();
+    }
+
     // Note: Level-specific state (collected items, etc.) would require
     // tracking changes in ObjectManager. For now, save basic state.
     // The game will reset the level when loaded, so items are restored.
@@ -540,6 +674,7 @@ bool Game::loadFromSaveFile(const std::string& filename) {
     }
     
     // Reload levels fresh
+    preloader.cancel();
     gameLevels.clear();
     ScreenParser::resetRiddleIndex();
     initGameLevels();
@@ -583,9 +718,11 @@ bool Game::loadFromSaveFile(const std::string& filename) {
     // Reset the current level
     if (currentLevelIndex >= 0 && currentLevelIndex < (int)gameLevels.size()) {
         gameLevels[currentLevelIndex]->reset();
+        gameLevels[currentLevelIndex]->setExploredRows(state.exploredRows);
     }
     
     recorder.resetCycle();
+    startRandomSession();
     
     return true;
 }
@@ -13,6 +13,11 @@
 #include "GameLevel.h"
 #include "GameRecorder.h"
 #include "GameStateSaver.h"
+#include "GameRandom.h"
+#include "TickScheduler.h"
+#include "KeyboardThread.h"
+#include "LevelPreloader.h"
+#include "LatencyTracker.h"
 #include <vector>
 #include <memory>
 #include <set>
@@ -61,6 +66,13 @@ private:
     std::unique_ptr<LoadGameScreen> loadGameScreen;
     std::vector<std::unique_ptr<GameLevel>> gameLevels;
     
+    // Rooms left with timers still running (level indices, ascending)
+    std::vector<int> backgroundRooms;
+    
+    // Readies the current level's door targets on a worker (declared after the
+    // levels so it stops before they are destroyed)
+    LevelPreloader preloader;
+    
     // Current state
     GameState currentState;
     int currentLevelIndex;
@@ -70,6 +82,19 @@ private:
     // Recording/playback system
     GameRecorder recorder;
     
+    // Game flow events (screen changes, game end), dispatched after each transition
+    StepEvents flowEvents;
+    EventBus eventBus;
+    
+    // Keyboard reader thread (runs during gameplay in normal and recording modes)
+    KeyboardThread keyboard;
+    
+    // Keypress-to-screen latency of this session (reported on exit)
+    LatencyTracker latency;
+    
+    // Session random generator (passed to levels; state is recorded for replay)
+    GameRandom random;
+    
 public:
     // Getters
     GameState getState() const { return currentState; }
@@ -78,6 +103,8 @@ public:
     // Recorder access
     GameRecorder& getRecorder() { return recorder; }
     const GameRecorder& getRecorder() const { return recorder; }
+    KeyboardThread& getKeyboard() { return keyboard; }
+    LatencyTracker& getLatency() { return latency; }
 
 private:
     // Setup and level creation
@@ -86,7 +113,12 @@ private:
     void createVictoryLevel();
     void handleScreenResult(ScreenResult result);
     void resetPlayers();
-    void runCurrentScreen();
+    void startRandomSession();
+    void runCurrentScreen(bool render = true);
+    void updateBackgroundRooms();
+    void preloadDoorTargets();
+    void reportTickOverruns(const TickScheduler& ticks) const;
+    void reportLatency() const;
     
     // Mode-specific run methods
     void runNormalMode();
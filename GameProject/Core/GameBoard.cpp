@@ -5,8 +5,46 @@
 #include "console.h"
 #include <iostream>
 
+// Board-sized cell masks
+bool BoardMask::test(const Point& p) const {
+    return p.isInBounds() && rows[p.getY()][p.getX()];
+}
+
+void BoardMask::set(const Point& p) {
+    if (p.isInBounds()) rows[p.getY()].set(p.getX());
+}
+
+bool BoardMask::none() const {
+    for (const auto& row : rows) {
+        if (row.any()) return false;
+    }
+    return true;
+}
+
+BoardMask& BoardMask::operator|=(const BoardMask& other) {
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) rows[y] |= other.rows[y];
+    return *this;
+}
+
+BoardMask BoardMask::operator-(const BoardMask& other) const {
+    BoardMask result;
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) result.rows[y] = rows[y] & ~other.rows[y];
+    return result;
+}
+
+std::vector<Point> BoardMask::toPoints() const {
+    std::vector<Point> points;
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        if (rows[y].none()) continue;
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            if (rows[y][x]) points.push_back(Point(x, y));
+        }
+    }
+    return points;
+}
+
 // Initialize board with empty cells
-GameBoard::GameBoard() {
+GameBoard::GameBoard() : masksDirty(false) {
     clear();
 }
 
@@ -16,7 +54,13 @@ void GameBoard::clear() {
         for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
             cells[y][x] = GameConfig::CHAR_EMPTY;
         }
+        occupiedRows[y].reset();
+        obstacleRows[y].reset();
+        wallRows[y].reset();
+        brushRows[y].reset();
+        fireRows[y].reset();
     }
+    masksDirty = false;
 }
 
 // Get cell at coordinates
@@ -35,6 +79,7 @@ char GameBoard::getCell(const Point& p) const {
 void GameBoard::setCell(int x, int y, char c) {
     if (x >= 0 && x < GameConfig::GAME_WIDTH && y >= 0 && y < GameConfig::GAME_HEIGHT) {
         cells[y][x] = c;
+        if (!masksDirty) updateMasks(x, y);
     }
 }
 
@@ -64,9 +109,64 @@ bool GameBoard::isBlocked(const Point& p) const {
 
 // Direct board access for Gate efficiency
 char (*GameBoard::getRawBoard())[GameConfig::GAME_WIDTH] {
+    masksDirty = true;
     return cells;
 }
 
+// Bit planes
+void GameBoard::updateMasks(int x, int y) const {
+    char c = cells[y][x];
+    occupiedRows[y][x] = (c != ' ' && c != GameConfig::CHAR_EMPTY);
+    obstacleRows[y][x] = (c == GameConfig::CHAR_OBSTACLE);
+    wallRows[y][x] = (c == GameConfig::CHAR_WALL);
+    brushRows[y][x] = (c == GameConfig::CHAR_BRUSH);
+    fireRows[y][x] = (c == GameConfig::CHAR_FIRE);
+}
+
+void GameBoard::rebuildMasks() const {
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            updateMasks(x, y);
+        }
+    }
+    masksDirty = false;
+}
+
+const BoardRowMask& GameBoard::getOccupiedRow(int y) const {
+    static const BoardRowMask outside = BoardRowMask().set();
+    if (y < 0 || y >= GameConfig::GAME_HEIGHT) return outside;
+    if (masksDirty) rebuildMasks();
+    return occupiedRows[y];
+}
+
+const BoardRowMask& GameBoard::getObstacleRow(int y) const {
+    static const BoardRowMask none;
+    if (y < 0 || y >= GameConfig::GAME_HEIGHT) return none;
+    if (masksDirty) rebuildMasks();
+    return obstacleRows[y];
+}
+
+const BoardRowMask& GameBoard::getWallRow(int y) const {
+    static const BoardRowMask outside = BoardRowMask().set();
+    if (y < 0 || y >= GameConfig::GAME_HEIGHT) return outside;
+    if (masksDirty) rebuildMasks();
+    return wallRows[y];
+}
+
+const BoardRowMask& GameBoard::getBrushRow(int y) const {
+    static const BoardRowMask none;
+    if (y < 0 || y >= GameConfig::GAME_HEIGHT) return none;
+    if (masksDirty) rebuildMasks();
+    return brushRows[y];
+}
+
+const BoardRowMask& GameBoard::getFireRow(int y) const {
+    static const BoardRowMask none;
+    if (y < 0 || y >= GameConfig::GAME_HEIGHT) return none;
+    if (masksDirty) rebuildMasks();
+    return fireRows[y];
+}
+
 // AI-assisted: Draw cell with color based on type
 void GameBoard::drawCell(int x, int y, bool isVisible) const {
     if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return;
@@ -109,6 +209,12 @@ void GameBoard::drawCell(int x, int y, bool isVisible) const {
     case '#':
         ::setColor(Color::Cyan);  // spring
         break;
+    case GameConfig::CHAR_BRUSH:
+        ::setColor(Color::Green);
+        break;
+    case GameConfig::CHAR_FIRE:
+        ::setColor(Color::LightRed);
+        break;
     default:
         if (c >= '1' && c <= '9') {
             ::setColor(Color::Magenta);  // doors
@@ -159,6 +265,12 @@ void GameBoard::draw(bool (*isVisibleFunc)(int, int)) const {
             case '+':
                 ::setColor(Color::Green);
                 break;
+            case GameConfig::CHAR_BRUSH:
+                ::setColor(Color::Green);
+                break;
+            case GameConfig::CHAR_FIRE:
+                ::setColor(Color::LightRed);
+                break;
             default:
                 if (c >= '1' && c <= '9') {
                     ::setColor(Color::Magenta);
@@ -4,11 +4,39 @@
 
 #include "GameConfig.h"
 #include "Point.h"
+#include <bitset>
+#include <vector>
+
+// One board row as bits (bit x = column x)
+using BoardRowMask = std::bitset<GameConfig::GAME_WIDTH>;
+
+// One bit per board cell (blast areas, preserved cells)
+struct BoardMask {
+    BoardRowMask rows[GameConfig::GAME_HEIGHT];
+
+    bool test(const Point& p) const;
+    void set(const Point& p);
+    bool none() const;
+    BoardMask& operator|=(const BoardMask& other);
+    BoardMask operator-(const BoardMask& other) const;  // Cells in this mask but not in other
+    std::vector<Point> toPoints() const;                 // Row-major order
+};
 
 class GameBoard {
 private:
     char cells[GameConfig::GAME_HEIGHT][GameConfig::GAME_WIDTH];
 
+    // Bit planes kept in sync with cells (rebuilt lazily after raw access)
+    mutable BoardRowMask occupiedRows[GameConfig::GAME_HEIGHT];  // cell is not empty
+    mutable BoardRowMask obstacleRows[GameConfig::GAME_HEIGHT];  // cell is an obstacle block
+    mutable BoardRowMask wallRows[GameConfig::GAME_HEIGHT];      // cell is a wall (blocks light)
+    mutable BoardRowMask brushRows[GameConfig::GAME_HEIGHT];     // cell is flammable brush
+    mutable BoardRowMask fireRows[GameConfig::GAME_HEIGHT];      // cell is burning
+    mutable bool masksDirty;
+
+    void updateMasks(int x, int y) const;
+    void rebuildMasks() const;
+
 public:
     GameBoard();
 
@@ -27,7 +55,14 @@ public:
     bool isGateBar(const Point& p) const;
     bool isBlocked(const Point& p) const;
 
-    // Direct board access (used by Gate)
+    // Bit rows for shape tests (rows outside the board read as fully occupied)
+    const BoardRowMask& getOccupiedRow(int y) const;
+    const BoardRowMask& getObstacleRow(int y) const;
+    const BoardRowMask& getWallRow(int y) const;
+    const BoardRowMask& getBrushRow(int y) const;   // Empty outside the board
+    const BoardRowMask& getFireRow(int y) const;    // Empty outside the board
+
+    // Direct board access (used by Gate; bit planes are refreshed on next query)
     char (*getRawBoard())[GameConfig::GAME_WIDTH];
 
     // Drawing
@@ -13,6 +13,7 @@ namespace GameConfig {
     
     // Timing
     constexpr int GAME_CYCLE_MS = 100;  // milliseconds per cycle
+    constexpr int MAX_CATCH_UP_CYCLES = 5;  // ticks run back to back (unrendered) when behind
     
     // Game element characters
     constexpr char CHAR_WALL = 'W';
@@ -26,6 +27,8 @@ namespace GameConfig {
     constexpr char CHAR_EMPTY = ' ';
     constexpr char CHAR_OBSTACLE = '*';
     constexpr char CHAR_TORCH = '!';
+    constexpr char CHAR_BRUSH = '%';  // flammable tile
+    constexpr char CHAR_FIRE = '^';   // burning tile
     
     // Player 1 controls
     constexpr char P1_UP = 'W';
@@ -43,6 +46,12 @@ namespace GameConfig {
     constexpr char P2_STAY = 'K';
     constexpr char P2_DISPOSE = 'O';
     
+    // Riddle answer keys (options a-d) of the player being asked. Player 1 can't move
+    // while asked, so A-D are free for them; player 2 answers with 1-4 so player 1
+    // keeps A/D for walking meanwhile.
+    constexpr char P1_ANSWER_KEYS[4] = { 'A', 'B', 'C', 'D' };
+    constexpr char P2_ANSWER_KEYS[4] = { '1', '2', '3', '4' };
+    
     // Special keys
     constexpr int KEY_ESC = 27;
 }
@@ -1,6 +1,6 @@
 // GameLevel.cpp - Core gameplay logic for a single level
-// Contains main update loop with spring momentum physics, bomb explosions, and shrapnel
-// AI usage: Spring momentum physics (AI written), player movement logic (AI assisted),
+// Contains the simulation step (movement via MovementSystem), bomb explosions, and shrapnel
+// AI usage: Player movement logic (AI assisted),
 //           bomb chain reactions (AI written), shrapnel animation (AI written)
 
 #include "GameLevel.h"
@@ -11,34 +11,35 @@
 #include <iostream>
 #include <cstdlib>
 #include <algorithm>
-#include <set>
 #include <string>
 
-// Constructor: Wire up all subsystems and seed random for heart spawning
+// Constructor: Wire up all subsystems
 GameLevel::GameLevel(int num)
     : levelNumber(num), result(ScreenResult::None), needsFullRedraw(true),
-    silentMode(false), player1(nullptr), player2(nullptr),
-    heartActive(false), heartRespawnTimer(HEART_RESPAWN_DELAY),
-    player1CrossedDoor(false), player2CrossedDoor(false), doorTargetScreen(-1) {
+    silentMode(false), detached(false), prepared(false), player1(nullptr), player2(nullptr), game(nullptr), random(nullptr),
+    doorTargetScreen(-1),
+    bombCountdown(0), heartActive(false),
+    presenter(*this) {
     statusBar.setLevelNumber(num);
     objects.setBoard(&board);
     collision.setBoard(&board);
     collision.setObjectManager(&objects);
+    movement.setBoard(&board);
+    movement.setObjectManager(&objects);
+    movement.setCollisionSystem(&collision);
     interactions.setBoard(&board);
     interactions.setObjectManager(&objects);
     interactions.setLightingSystem(&lighting);
-    interactions.setStatusBar(&statusBar);
-    interactions.setMessageDisplay(&messageDisplay);
     interactions.setGame(game);
     renderer.setBoard(&board);
     renderer.setLightingSystem(&lighting);
-
-    // Seed random once for heart spawning
-    static bool seeded = false;
-    if (!seeded) {
-        srand((unsigned int)time(nullptr));
-        seeded = true;
-    }
+    lighting.setBoard(&board);
+    fire.setBoard(&board);
+    interactions.setFireSystem(&fire);
+    messageDisplay.setSequencer(&sequencer);
+    burnCooldown[0] = burnCooldown[1] = 0;
+    eventBus.subscribe(&presenter);
+    heartSequence = sequencer.start(heartCycle());
 }
 
 // Connect player pointers to all systems that need them
@@ -49,6 +50,10 @@ void GameLevel::setPlayers(Player* p1, Player* p2) {
     lighting.setPlayers(p1, p2);
     input.setPlayers(p1, p2);
     renderer.setPlayers(p1, p2);
+
+    movement.clearMovers();
+    movement.addMover(p1, 1);
+    movement.addMover(p2, 2);
 }
 
 // Link game instance and pass recorder for save/load
@@ -57,13 +62,30 @@ void GameLevel::setGame(Game* g) {
     if (game) {
         input.setRecorder(&game->getRecorder());
         interactions.setRecorder(&game->getRecorder());
+        input.setKeyboard(&game->getKeyboard());
+        input.setLatencyTracker(&game->getLatency());
+
+        // Result events are only collected when they are saved or verified
+        GameRecorder& recorder = game->getRecorder();
+        if (recorder.isSaveMode() || recorder.isLoadMode()) {
+            eventBus.subscribe(&recorder, GameRecorder::RECORDED_EVENTS);
+        }
     }
 }
 
+// Session generator used for heart spawning
+void GameLevel::setRandom(GameRandom* rng) {
+    random = rng;
+}
+
 // Enable silent mode for automated testing
 void GameLevel::setSilentMode(bool silent) {
     silentMode = silent;
     renderer.setSilentMode(silent);
+
+    // Nothing is drawn or formatted for the console in silent mode
+    if (silent) eventBus.unsubscribe(&presenter);
+    else eventBus.subscribe(&presenter);
 }
 
 // Object creation delegates - forward to ObjectManager
@@ -90,7 +112,9 @@ void GameLevel::addGate(int x, int y, int width, int height, char doorNum) {
 }
 
 void GameLevel::addLightSwitch(int x, int y, bool startOn) { objects.addLightSwitch(x, y, startOn); }
-void GameLevel::addSwitch(int x, int y, char linkedGate, bool startOn) { objects.addSwitch(x, y, linkedGate, startOn); }
+void GameLevel::addSwitch(int x, int y, const std::string& linkedGates, bool startOn) { objects.addSwitch(x, y, linkedGates, startOn); }
+void GameLevel::setGateLogic(char doorNum, SignalLogic logic) { objects.setGateLogic(doorNum, logic); }
+void GameLevel::setLightLogic(SignalLogic logic) { objects.setLightLogic(logic); }
 void GameLevel::addTorch(int x, int y, int radius) { objects.addTorch(x, y, radius); }
 
 void GameLevel::addRiddle(int x, int y, const std::string& question,
@@ -102,12 +126,26 @@ void GameLevel::addBomb(int x, int y) { objects.addBomb(x, y); }
 void GameLevel::addCoin(int x, int y) { objects.addCoin(x, y); }
 void GameLevel::addObstacleCell(int x, int y) { objects.addObstacleCell(x, y); }
 void GameLevel::addSpringCell(int x, int y) { objects.addSpringCell(x, y); }
+void GameLevel::addBrush(int x, int y) { fire.addBrush(x, y); }
 
 // Lighting configuration
 void GameLevel::setDarkRoom(bool dark) { lighting.setDarkRoom(dark); }
 bool GameLevel::getIsDarkRoom() const { return lighting.getIsDarkRoom(); }
 void GameLevel::setTorchRadius(int radius) { lighting.setTorchRadius(radius); }
 
+std::vector<BoardRowMask> GameLevel::getExploredRows() const {
+    std::vector<BoardRowMask> rows;
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) rows.push_back(lighting.getExploredRow(y));
+    return rows;
+}
+
+void GameLevel::setExploredRows(const std::vector<BoardRowMask>& rows) {
+    for (int y = 0; y < GameConfig::GAME_HEIGHT && y < (int)rows.size(); y++) {
+        lighting.setExploredRow(y, rows[y]);
+    }
+    needsFullRedraw = true;
+}
+
 // Check if both players reached the exit door
 bool GameLevel::checkBothPlayersOnDoor() const {
     if (!player1 || !player2) return false;
@@ -119,9 +157,16 @@ void GameLevel::init() {
     objects.finalizeObstacles();
     objects.finalizeSprings();
 
-    lighting.setLightSwitches(objects.getLightSwitches());
+    objects.buildSignalGraph();
+    lighting.setRoomLight(objects.getSignals(), objects.getRoomLightSignal());
     lighting.setTorches(objects.getTorches());
     lighting.setDroppedTorches(objects.getDroppedTorches());
+    lighting.invalidate();
+
+    // Room for every bomb in the level exploding at once, so no blast loses its shrapnel
+    int bombCount = (int)objects.getBombs().size();
+    particles.reserve(bombCount > ParticleSystem::DEFAULT_EMITTERS ? bombCount : ParticleSystem::DEFAULT_EMITTERS,
+                      SHRAPNEL_RAYS);
 
     objects.updateBoard();
 }
@@ -140,28 +185,106 @@ void GameLevel::exit() {
     BaseScreen::exit();
 }
 
-// Reset level to initial state for retry or new game
-void GameLevel::reset() {
+void GameLevel::resetVisit() {
     result = ScreenResult::None;
     needsFullRedraw = true;
     messageDisplay.clear();
     pauseMenu.reset();
     input.setPaused(false);
 
-    heartActive = false;
-    heartRespawnTimer = HEART_RESPAWN_DELAY;
-    player1CrossedDoor = false;
-    player2CrossedDoor = false;
+    movement.resetFinished();
     doorTargetScreen = -1;
+    pendingInput = InputFrame();
+    pendingRiddle = PendingRiddle();
+    riddleFeedback = Sequence();
+    burnCooldown[0] = burnCooldown[1] = 0;
+}
+
+// Reset level to initial state for retry or new game
+void GameLevel::reset() {
+    resetVisit();
+    detached = false;
+    restore();
+    renderer.discardComposed();
+    prepared = false;
+}
+
+void GameLevel::restore() {
+    heartActive = false;
+    heartSequence = sequencer.start(heartCycle());
+    bombCountdown = 0;
+    detonations.clear();
 
     objects.reset();
     objects.updateBoard();
+    particles.clear();  // Shrapnel from before the reset would outlive its bomb
+    fire.reset();
+    lighting.clearExplored();
 }
 
-// Process keyboard input for pause menu, save, and item drops
+// Door-target preloading (prepare runs on the preloader's worker)
+void GameLevel::prepare() {
+    restore();
+    if (!lighting.getIsDarkRoom()) renderer.composeBoard();  // Dark rooms depend on where the players stand
+    prepared = true;
+}
+
+bool GameLevel::isPrepared() const {
+    return prepared;
+}
+
+void GameLevel::enterPrepared() {
+    resetVisit();
+    detached = false;
+    prepared = false;
+}
+
+std::vector<int> GameLevel::getDoorTargetScreens() const {
+    return objects.getDoorTargets();
+}
+
+// Background rooms
+bool GameLevel::hasPendingActivity() const {
+    return objects.hasTickingBomb() || !particles.empty() || fire.hasFire();
+}
+
+void GameLevel::leave() {
+    detached = true;
+}
+
+bool GameLevel::isDetached() const {
+    return detached;
+}
+
+// Only the timers run: no input, movers, hearts or riddles, and with nobody in the
+// room shrapnel hits no one. The events are dropped; the room is redrawn in full
+// when the players come back. Once nothing is left running the room stays detached
+// but dormant: the next visit resumes it as it settled instead of resetting it.
+void GameLevel::stepBackground() {
+    StepEvents& events = stepEvents;
+    events.clear();
+    updateBombs(events);
+    updateShrapnel(events);
+    updateFire(events);
+}
+
+// Objects, fire and timers stay as the background steps left them
+void GameLevel::resume() {
+    resetVisit();
+    detached = false;
+}
+
+// Process keyboard input for pause menu and save; player commands wait for the next step
 void GameLevel::handleInput() {
     input.setPaused(pauseMenu.getIsPaused());
+    input.setRiddlePlayer(hasPendingRiddle() ? pendingRiddle.playerNum : 0);
     InputResult inputResult = input.processInput();
+    pendingInput = inputResult.frame;
+
+    // Keys drained alongside a pause or menu request are not stepped this cycle
+    if ((inputResult.escPressed || inputResult.menuRequested) && game) {
+        game->getLatency().discardPending();
+    }
 
     if (inputResult.escPressed) {
         pauseMenu.toggle();
@@ -183,26 +306,34 @@ void GameLevel::handleInput() {
         needsFullRedraw = true;
         return;
     }
+}
 
-    // Player 1 drops item
-    if (inputResult.player1Dispose && player1) {
-        interactions.dropPlayerItem(*player1);
-        if (player1->hasTorch()) needsFullRedraw = true;
-        renderer.drawCell(player1->getPosition().getX(), player1->getPosition().getY());
-    }
+// Player number used in events and recordings
+int GameLevel::playerNumber(const Player& player) const {
+    return (&player == player1) ? 1 : 2;
+}
+
+// Apply one player's commands for this cycle (direction, stop, then item drop)
+void GameLevel::applyPlayerInput(Player* player, const PlayerInput& cmd, StepEvents& events) {
+    if (!player) return;
 
-    // Player 2 drops item
-    if (inputResult.player2Dispose && player2) {
-        interactions.dropPlayerItem(*player2);
-        if (player2->hasTorch()) needsFullRedraw = true;
-        renderer.drawCell(player2->getPosition().getX(), player2->getPosition().getY());
+    if (cmd.hasDirection) player->setDirection(cmd.direction);
+    if (cmd.stop) player->stop();
+
+    if (cmd.dispose) {
+        int playerNum = playerNumber(*player);
+        interactions.dropPlayerItem(*player, playerNum, events);
+        events.push(StepEvent(StepEventType::CellChanged, playerNum, player->getPosition()));
     }
 }
 
 // AI-assisted: Player movement handling with gates, riddles, obstacles, and springs
 // Handles spring compression/release, gate key requirements, riddle blocking,
 // obstacle collision, and standard movement with interaction callbacks
-void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
+void GameLevel::handlePlayerMovement(Mover& mover, StepEvents& events) {
+    Player& player = *mover.player;
+    int playerNum = mover.id;
+
     // Check spring release for stationary players (STAY key release)
     // This must happen BEFORE canMoveThisFrame check to support STAY key
     if (!player.getIsMoving()) {
@@ -213,10 +344,10 @@ void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
                 Spring::ReleaseInfo info = spring->release();
                 if (info.released) {
                     player.setSpringMomentum(info.direction, info.speed, info.duration);
-                    messageDisplay.show("Spring launched! Speed: " + std::to_string(info.speed));
+                    events.push(StepEvent(StepEventType::SpringLaunched, playerNum, player.getPosition(), info.speed));
                 }
                 spring->updateBoard(&board);
-                needsFullRedraw = true;
+                events.push(StepEvent(StepEventType::FullRedraw));
             }
         }
         return;
@@ -224,91 +355,47 @@ void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
     
     if (!player.canMoveThisFrame()) return;
 
-    // Ignore other player if they've finished (crossed door)
-    if (otherPlayer == player1 && player1CrossedDoor) otherPlayer = nullptr;
-    else if (otherPlayer == player2 && player2CrossedDoor) otherPlayer = nullptr;
-
     Point nextPos = player.getNextPosition();
 
     // Gate interaction - need key
     Gate* gate = objects.getGateAt(nextPos);
     if (gate && !gate->getIsOpen()) {
         if (player.hasKey()) {
-            interactions.tryOpenGate(player, nextPos);
-            // Redraw gate perimeter
-            int gx = gate->getX(), gy = gate->getY();
-            int gw = gate->getWidth(), gh = gate->getHeight();
-            for (int i = 0; i < gw; i++) {
-                renderer.drawCell(gx + i, gy);
-                renderer.drawCell(gx + i, gy + gh - 1);
-            }
-            for (int i = 1; i < gh - 1; i++) {
-                renderer.drawCell(gx, gy + i);
-                renderer.drawCell(gx + gw - 1, gy + i);
-            }
+            interactions.tryOpenGate(player, playerNum, nextPos, events);
         } else {
-            messageDisplay.show("You need a KEY to open this gate!");
+            events.push(StepEvent(StepEventType::NeedKey, playerNum, nextPos));
             player.stop();
         }
         return;
     }
 
-    // Riddle blocks both players until answered
+    // Riddle blocks the player until answered (one riddle is asked at a time)
     Riddle* riddle = objects.getRiddleAt(nextPos);
     if (riddle && riddle->isActive()) {
         player.stop();
-        if (otherPlayer) otherPlayer->stop();
-
-        int playerNum = (&player == player1) ? 1 : 2;
-        bool correct = interactions.handleRiddle(player, *riddle, playerNum);
-        ::markRiddleUsed(riddle->getQuestion());
-        
-        // Record riddle event
-        if (game) {
-            char answer = interactions.getLastRiddleAnswer();
-            game->getRecorder().recordRiddle(playerNum, riddle->getQuestion(), 
-                                             answer, correct);
-        }
-
-        if (correct) {
-            riddle->deactivate();
-            board.setCell(nextPos.getX(), nextPos.getY(), ' ');
-            needsFullRedraw = true;
-        } else {
-            // Record life lost
-            if (game) {
-                game->getRecorder().recordLifeLost(playerNum);
-            }
-            if (!LivesManager::hasLivesRemaining()) {
-                result = ScreenResult::GameOver;
-            }
-            needsFullRedraw = true;
-        }
+        if (pendingRiddle.phase == RiddlePhase::Asking) return;
+
+        // Ask it (cutting short another riddle's feedback); the answer arrives in
+        // this player's input on a later cycle
+        riddleFeedback = Sequence();
+        pendingRiddle = PendingRiddle();
+        pendingRiddle.phase = RiddlePhase::Asking;
+        pendingRiddle.riddle = riddle;
+        pendingRiddle.playerNum = playerNum;
+        pendingRiddle.pos = nextPos;
+        events.push(StepEvent(StepEventType::RiddleAsked, playerNum, nextPos, 0, 0, riddle));
         return;
     }
 
     // Obstacle pushing
     Obstacle* obstacle = objects.getObstacleAt(nextPos);
-    if (obstacle) {
-        Direction dir = player.getDirection();
-        if (!tryPushObstacle(player, otherPlayer, dir)) {
-            player.stop();
-            return;
-        }
-        needsFullRedraw = true;
+    if (obstacle && !movement.tryPushObstacle(mover, player.getDirection(), events)) {
+        player.stop();
+        return;
     }
 
     // Standard collision check
-    if (collision.checkMovementCollision(nextPos, otherPlayer)) {
-        // Transfer momentum on player collision
-        if (player.hasActiveSpringMomentum() && otherPlayer && otherPlayer->getPosition() == nextPos) {
-            otherPlayer->setSpringMomentum(
-                player.getSpringDirection(),
-                player.getSpringSpeed(),
-                player.getSpringSpeed() * player.getSpringSpeed()
-            );
-        }
-        
+    if (movement.isMoveBlocked(mover, nextPos)) {
         // Check spring release when blocked by wall (max compression release)
         Spring* spring = objects.getSpringAt(player.getPosition());
         if (spring && spring->getIsCompressed() && spring->getCompressingPlayer() == &player) {
@@ -317,10 +404,10 @@ void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
                 Spring::ReleaseInfo info = spring->release();
                 if (info.released) {
                     player.setSpringMomentum(info.direction, info.speed, info.duration);
-                    messageDisplay.show("Spring launched! Speed: " + std::to_string(info.speed));
+                    events.push(StepEvent(StepEventType::SpringLaunched, playerNum, player.getPosition(), info.speed));
                 }
                 spring->updateBoard(&board);
-                needsFullRedraw = true;
+                events.push(StepEvent(StepEventType::FullRedraw));
             }
         }
         
@@ -329,16 +416,12 @@ void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
     }
 
     // Actually move
-    Point oldPos = player.getPosition();
-    player.erase();
-    renderer.drawCell(oldPos.getX(), oldPos.getY());
-    player.move();
+    movement.moveForward(mover, events);
 
     // Did player reach door?
     if (board.isDoor(player.getPosition())) {
         Point doorPos = player.getPosition();
-        player.erase();
-        renderer.drawCell(doorPos.getX(), doorPos.getY());
+        events.push(StepEvent(StepEventType::CellChanged, playerNum, doorPos));
         
         // Store the door's target screen
         Door* door = objects.getDoorAt(doorPos);
@@ -346,261 +429,260 @@ void GameLevel::handlePlayerMovement(Player& player, Player* otherPlayer) {
             doorTargetScreen = door->getTargetScreen();
         }
         
-        if (&player == player1) player1CrossedDoor = true;
-        else if (&player == player2) player2CrossedDoor = true;
+        movement.setFinished(mover);
         return;
     }
 
-    handleSpringInteraction(player, otherPlayer);
+    handleSpringInteraction(player, events);
 
     // Heart pickup
     if (heartActive && player.getPosition() == heart.getPosition()) {
         LivesManager::addLife();
-        messageDisplay.show("+1 Life!");
-        despawnHeart();
-        needsFullRedraw = true;
+        events.push(StepEvent(StepEventType::LifeGained, playerNum, player.getPosition()));
+        despawnHeart(events);
+        events.push(StepEvent(StepEventType::FullRedraw));
     }
 
     // Item pickups etc
-    InteractionResult interactionResult = interactions.handleInteractions(player);
+    InteractionResult interactionResult = interactions.handleInteractions(player, playerNum, events);
     if (interactionResult.gameOver) {
         result = ScreenResult::GameOver;
         return;
     }
-    if (interactionResult.needsFullRedraw) needsFullRedraw = true;
-    else if (interactionResult.needsRedraw) renderer.drawCell(player.getPosition().getX(), player.getPosition().getY());
+    if (interactionResult.needsFullRedraw) events.push(StepEvent(StepEventType::FullRedraw));
+    else if (interactionResult.needsRedraw) events.push(StepEvent(StepEventType::CellChanged, playerNum, player.getPosition()));
 
-    // Redraw torch light in dark rooms
-    if (lighting.getIsDarkRoom() && !lighting.isRoomLit() && player.hasTorch()) {
-        int radius = lighting.getTorchRadius() + 2;
-        renderer.redrawTorchArea(player.getPosition().getX(), player.getPosition().getY(), radius);
+    // Torch light follows its holder
+    if (player.hasTorch()) {
+        events.push(StepEvent(StepEventType::TorchMoved, playerNum, player.getPosition()));
     }
 }
 
-// AI-written: Main game loop update with spring momentum physics
-// Handles spring-launched movement with multi-cell traversal, momentum transfer
-// between players on collision, perpendicular steering during spring flight,
-// and cooperative obstacle pushing during momentum. Complex direction tracking
-// and force calculation for physics-accurate spring behavior.
-void GameLevel::update() {
-    if (result != ScreenResult::None) return;
-    if (pauseMenu.getIsPaused()) return;
-
-    messageDisplay.update();
-    updateHeart();
-    updateBombs();
-    updateShrapnel();
-
-    // Player 1 movement (spring momentum overrides normal movement)
-    if (player1) {
-        if (player1->hasActiveSpringMomentum()) {
-            Direction springDir = player1->getSpringDirection();
-            Direction inputDir = player1->getDirection();
-            int speed = player1->getSpringSpeed();
-            int duration = player1->getSpringSpeed() * player1->getSpringSpeed();
-            
-            // Classify input relative to spring direction
-            bool isBackward = false;
-            if (springDir == Direction::RIGHT && inputDir == Direction::LEFT) isBackward = true;
-            if (springDir == Direction::LEFT && inputDir == Direction::RIGHT) isBackward = true;
-            if (springDir == Direction::UP && inputDir == Direction::DOWN) isBackward = true;
-            if (springDir == Direction::DOWN && inputDir == Direction::UP) isBackward = true;
-            
-            bool isLateral = false;
-            if ((springDir == Direction::LEFT || springDir == Direction::RIGHT) &&
-                (inputDir == Direction::UP || inputDir == Direction::DOWN)) isLateral = true;
-            if ((springDir == Direction::UP || springDir == Direction::DOWN) &&
-                (inputDir == Direction::LEFT || inputDir == Direction::RIGHT)) isLateral = true;
-            
-            // Move at spring speed in spring direction
-            player1->setDirection(springDir);
-            for (int i = 0; i < speed; i++) {
-                Point nextPos = player1->getNextPosition();
-                
-                if (!nextPos.isInBounds()) break;
-                
-                char cell = board.getCell(nextPos);
-                if (cell == 'W') break;
-                
-                // Transfer momentum on collision
-                if (player2 && nextPos == player2->getPosition()) {
-                    player2->setSpringMomentum(springDir, speed, duration);
-                    messageDisplay.show("Momentum transferred!");
-                    break;
-                }
-                
-                // Try cooperative push
-                Obstacle* obstacle = objects.getObstacleAt(nextPos);
-                if (obstacle) {
-                    int force = player1->getForce();
-
-                    if (player2) {
-                        Point otherPos = player2->getPosition();
-                        int dx = std::abs(player1->getPosition().getX() - otherPos.getX());
-                        int dy = std::abs(player1->getPosition().getY() - otherPos.getY());
-                        bool playersAdjacent = (dx == 1 && dy == 0) || (dx == 0 && dy == 1);
-                        Point otherNextPos = otherPos.getNextPosition(springDir);
-                        bool otherAdjacentToObstacle = obstacle->containsPoint(otherNextPos);
-
-                        if (playersAdjacent || otherAdjacentToObstacle) {
-                            bool otherHasSpringMomentum = player2->hasActiveSpringMomentum() &&
-                                                         player2->getSpringDirection() == springDir;
-                            bool sameDirection = (player2->getDirection() == springDir);
-                            bool recentlySameDirection = (player2->getLastMoveDirection() == springDir &&
-                                                          player2->getLastMoveAge() <= 5);
-
-                            if (otherHasSpringMomentum || sameDirection || recentlySameDirection) {
-                                force += player2->getForce();
-                            }
-                        }
-                    }
-
-                    if (obstacle->canPush(springDir, &board, force)) {
-                        obstacle->push(springDir, &board, force);
-                        needsFullRedraw = true;
-                    } else {
-                        break;
-                    }
-                }
-                
-                if (cell == '*' || cell == '|' || cell == '-') break;
-                
-                player1->erase();
-                renderer.drawCell(player1->getPosition().getX(), player1->getPosition().getY());
-                player1->move();
-            }
-            
-            // Allow perpendicular steering while in spring momentum
-            if (isLateral && !isBackward) {
-                player1->setDirection(inputDir);
-                Point nextPos = player1->getNextPosition();
-                Player* p2ForCollision = player2CrossedDoor ? nullptr : player2;
-                
-                if (nextPos.isInBounds() && !collision.checkMovementCollision(nextPos, p2ForCollision)) {
-                    char cell = board.getCell(nextPos);
-                    if (cell != 'W' && cell != '*' && cell != '|' && cell != '-') {
-                        player1->erase();
-                        renderer.drawCell(player1->getPosition().getX(), player1->getPosition().getY());
-                        player1->move();
-                    }
-                }
-            }
-            
+// Simulation step: input, timed sequences, bombs, shrapnel, fire, every mover in order,
+// then the riddle
+const StepEvents& GameLevel::step(const InputFrame& frame) {
+    StepEvents& events = stepEvents;
+    events.clear();
+    if (result != ScreenResult::None) return events;
+
+    // A player answering a riddle ignores movement input
+    if (!isAnsweringRiddle(1)) applyPlayerInput(player1, frame.player1, events);
+    if (!isAnsweringRiddle(2)) applyPlayerInput(player2, frame.player2, events);
+
+    sequencer.tick();
+    updateBombs(events);
+    updateShrapnel(events);
+    updateFire(events);
+
+    // Movers act in a fixed order (spring momentum overrides normal movement)
+    movement.syncPositions();
+    for (auto& mover : movement.getMovers()) {
+        if (isAnsweringRiddle(mover.id)) continue;
+        if (mover.player->hasActiveSpringMomentum()) {
+            movement.updateSpringFlight(mover, events);
         } else {
-            handlePlayerMovement(*player1, player2);
+            handlePlayerMovement(mover, events);
         }
-        player1->updateSpringMomentum();
-        player1->updateLastMoveAge();
+        mover.player->updateSpringMomentum();
+        mover.player->updateLastMoveAge();
     }
 
-    // Player 2 movement (same logic as player 1)
-    if (player2) {
-        if (player2->hasActiveSpringMomentum()) {
-            Direction springDir = player2->getSpringDirection();
-            Direction inputDir = player2->getDirection();
-            int speed = player2->getSpringSpeed();
-            int duration = player2->getSpringSpeed() * player2->getSpringSpeed();
-            
-            bool isBackward = false;
-            if (springDir == Direction::RIGHT && inputDir == Direction::LEFT) isBackward = true;
-            if (springDir == Direction::LEFT && inputDir == Direction::RIGHT) isBackward = true;
-            if (springDir == Direction::UP && inputDir == Direction::DOWN) isBackward = true;
-            if (springDir == Direction::DOWN && inputDir == Direction::UP) isBackward = true;
-            
-            bool isLateral = false;
-            if ((springDir == Direction::LEFT || springDir == Direction::RIGHT) &&
-                (inputDir == Direction::UP || inputDir == Direction::DOWN)) isLateral = true;
-            if ((springDir == Direction::UP || springDir == Direction::DOWN) &&
-                (inputDir == Direction::LEFT || inputDir == Direction::RIGHT)) isLateral = true;
-            
-            player2->setDirection(springDir);
-            for (int i = 0; i < speed; i++) {
-                Point nextPos = player2->getNextPosition();
-                
-                if (!nextPos.isInBounds()) break;
-                
-                char cell = board.getCell(nextPos);
-                if (cell == 'W') break;
-                
-                if (player1 && nextPos == player1->getPosition()) {
-                    player1->setSpringMomentum(springDir, speed, duration);
-                    messageDisplay.show("Momentum transferred!");
-                    break;
-                }
-                
-                Obstacle* obstacle = objects.getObstacleAt(nextPos);
-                if (obstacle) {
-                    int force = player2->getForce();
-
-                    if (player1) {
-                        Point otherPos = player1->getPosition();
-                        int dx = std::abs(player2->getPosition().getX() - otherPos.getX());
-                        int dy = std::abs(player2->getPosition().getY() - otherPos.getY());
-                        bool playersAdjacent = (dx == 1 && dy == 0) || (dx == 0 && dy == 1);
-                        Point otherNextPos = otherPos.getNextPosition(springDir);
-                        bool otherAdjacentToObstacle = obstacle->containsPoint(otherNextPos);
-
-                        if (playersAdjacent || otherAdjacentToObstacle) {
-                            bool otherHasSpringMomentum = player1->hasActiveSpringMomentum() &&
-                                                         player1->getSpringDirection() == springDir;
-                            bool sameDirection = (player1->getDirection() == springDir);
-                            bool recentlySameDirection = (player1->getLastMoveDirection() == springDir &&
-                                                          player1->getLastMoveAge() <= 5);
-
-                            if (otherHasSpringMomentum || sameDirection || recentlySameDirection) {
-                                force += player1->getForce();
-                            }
-                        }
-                    }
+    burnPlayersInFire(events);
+
+    // Answers only come from input read while the riddle was already open (handleInput
+    // tells InputHandler who is asked before reading keys), so the cycle a riddle is
+    // reached never carries one; its keys were ordinary movement
+    updateRiddle(frame, events);
 
-                    if (obstacle->canPush(springDir, &board, force)) {
-                        obstacle->push(springDir, &board, force);
-                        needsFullRedraw = true;
-                    } else {
-                        break;
-                    }
-                }
-                
-                if (cell == '*' || cell == '|' || cell == '-') break;
-                
-                player2->erase();
-                renderer.drawCell(player2->getPosition().getX(), player2->getPosition().getY());
-                player2->move();
-            }
-            
-            if (isLateral && !isBackward) {
-                player2->setDirection(inputDir);
-                Point nextPos = player2->getNextPosition();
-                Player* p1ForCollision = player1CrossedDoor ? nullptr : player1;
-                
-                if (nextPos.isInBounds() && !collision.checkMovementCollision(nextPos, p1ForCollision)) {
-                    char cell = board.getCell(nextPos);
-                    if (cell != 'W' && cell != '*' && cell != '|' && cell != '-') {
-                        player2->erase();
-                        renderer.drawCell(player2->getPosition().getX(), player2->getPosition().getY());
-                        player2->move();
-                    }
-                }
-            }
-            
-        } else {
-            handlePlayerMovement(*player2, player1);
-        }
-        player2->updateSpringMomentum();
-        player2->updateLastMoveAge();
-    }
-    
     // Keep spring visuals updated
     for (auto& spring : objects.getSprings()) {
         spring->updateBoard(&board);
     }
 
-    // Both finished? Level complete
-    if (player1CrossedDoor && player2CrossedDoor) {
+    // Everyone finished? Level complete
+    if (movement.allFinished()) {
         result = ScreenResult::NextScreen;
     }
+
+    return events;
+}
+
+bool GameLevel::hasPendingRiddle() const {
+    return pendingRiddle.phase == RiddlePhase::Asking;
+}
+
+bool GameLevel::isPaused() const {
+    return pauseMenu.getIsPaused();
+}
+
+bool GameLevel::isAnsweringRiddle(int playerNum) const {
+    return pendingRiddle.phase == RiddlePhase::Asking && pendingRiddle.playerNum == playerNum;
 }
 
+// Advance the riddle modal one cycle: take the asked player's answer
+// (the feedback is closed by its own sequence)
+void GameLevel::updateRiddle(const InputFrame& frame, StepEvents& events) {
+    switch (pendingRiddle.phase) {
+    case RiddlePhase::Asking: {
+        // Blown up while being asked
+        if (!pendingRiddle.riddle->isActive()) {
+            pendingRiddle = PendingRiddle();
+            events.push(StepEvent(StepEventType::RiddleClosed));
+            break;
+        }
+        const PlayerInput& in = (pendingRiddle.playerNum == 1) ? frame.player1 : frame.player2;
+        if (in.answer != '\0') resolveRiddle(in.answer, events);
+        break;
+    }
+    case RiddlePhase::Feedback:
+    case RiddlePhase::None:
+        break;
+    }
+}
+
+// Apply the answer to the riddle being asked, then show the result for a while
+void GameLevel::resolveRiddle(char answer, StepEvents& events) {
+    Riddle* riddle = pendingRiddle.riddle;
+    int playerNum = pendingRiddle.playerNum;
+    Point pos = pendingRiddle.pos;
+
+    bool correct = riddle->checkAnswer(answer);
+    pendingRiddle.phase = RiddlePhase::Feedback;
+    riddleFeedback = sequencer.start(closeRiddleAfter(correct ? RIDDLE_CORRECT_CYCLES : RIDDLE_WRONG_CYCLES));
+    ::markRiddleUsed(riddle->getQuestion());
+    events.push(StepEvent(StepEventType::RiddleAnswered, playerNum, pos, answer, correct ? 1 : 0, riddle));
+
+    if (correct) {
+        riddle->deactivate();
+        board.setCell(pos.getX(), pos.getY(), ' ');
+    } else {
+        LivesManager::subtractLife();
+        events.push(StepEvent(StepEventType::LifeLost, playerNum, pos));
+        if (!LivesManager::hasLivesRemaining()) {
+            result = ScreenResult::GameOver;
+        }
+    }
+    events.push(StepEvent(StepEventType::FullRedraw));
+}
+
+Sequence GameLevel::closeRiddleAfter(int feedbackCycles) {
+    co_await cycles(feedbackCycles);
+    pendingRiddle = PendingRiddle();
+    stepEvents.push(StepEvent(StepEventType::RiddleClosed));
+}
+
+// Run one cycle: simulate, then let recording and the console catch up
+void GameLevel::update() {
+    if (result != ScreenResult::None) return;
+    if (pauseMenu.getIsPaused()) return;
+
+    const StepEvents& events = step(pendingInput);
+    pendingInput = InputFrame();
+    if (game) game->getLatency().stepApplied();
+    eventBus.dispatch(events);
+    statusBar.setBombCountdown(bombCountdown);
+}
+
+// Console presenter: cell redraws, status bar, messages and the riddle panel
+void GameLevel::presentEvents(const StepEvents& events) {
+    // Bring the light map up to date and redraw only cells whose light changed
+    if (!silentMode && lighting.update()) renderer.redrawVisibilityChanges();
+
+    for (const StepEvent& e : events) {
+        int x = e.pos.getX();
+        int y = e.pos.getY();
+
+        switch (e.type) {
+        case StepEventType::CellChanged:
+        case StepEventType::PlayerMoved:
+            renderer.drawCell(x, y);
+            break;
+        case StepEventType::TorchMoved:
+            // Light map delta was redrawn above
+            break;
+        case StepEventType::GateOpened:
+            // Redraw gate perimeter (value/extra = width/height)
+            for (int i = 0; i < e.value; i++) {
+                renderer.drawCell(x + i, y);
+                renderer.drawCell(x + i, y + e.extra - 1);
+            }
+            for (int i = 1; i < e.extra - 1; i++) {
+                renderer.drawCell(x, y + i);
+                renderer.drawCell(x + e.value - 1, y + i);
+            }
+            messageDisplay.show("Gate opened!");
+            break;
+        case StepEventType::FullRedraw:
+            needsFullRedraw = true;
+            break;
+        case StepEventType::StatusChanged:
+            if (!silentMode) {
+                statusBar.setDarkRoomStatus(lighting.getIsDarkRoom(), lighting.isRoomLit());
+                statusBar.draw();
+            }
+            break;
+        case StepEventType::NeedKey:
+            messageDisplay.show("You need a KEY to open this gate!");
+            break;
+        case StepEventType::GateUnlocked:
+            messageDisplay.show("All switches ON - Gate opened!");
+            break;
+        case StepEventType::GateLocked:
+            messageDisplay.show("Switch OFF - Gate locked!");
+            break;
+        case StepEventType::SwitchToggled:
+            messageDisplay.show(e.value ? "Switch ON!" : "Switch OFF!");
+            break;
+        case StepEventType::LightToggled:
+            messageDisplay.show(e.value ? "Light ON!" : "Light OFF!");
+            break;
+        case StepEventType::ItemPickedUp:
+            if (e.value == GameConfig::CHAR_KEY) messageDisplay.show("Picked up a KEY!");
+            else if (e.value == GameConfig::CHAR_COIN) messageDisplay.show("Picked up a COIN!");
+            else if (e.value == GameConfig::CHAR_TORCH) messageDisplay.show("Picked up a TORCH!");
+            else messageDisplay.show("Picked up a BOMB! Press drop key to plant.");
+            break;
+        case StepEventType::ItemDropped:
+            if (e.value == GameConfig::CHAR_KEY) messageDisplay.show("Dropped a KEY!");
+            else if (e.value == GameConfig::CHAR_TORCH) messageDisplay.show("Dropped a TORCH!");
+            else messageDisplay.show("BOMB PLANTED! 5 cycles to explosion!");
+            break;
+        case StepEventType::SpringLaunched:
+            messageDisplay.show("Spring launched! Speed: " + std::to_string(e.value));
+            break;
+        case StepEventType::MomentumTransferred:
+            messageDisplay.show("Momentum transferred!");
+            break;
+        case StepEventType::ChainReaction:
+            messageDisplay.show("Chain reaction! " + std::to_string(e.value) + " bomb(s) activated!");
+            break;
+        case StepEventType::LifeGained:
+            messageDisplay.show("+1 Life!");
+            break;
+        case StepEventType::FireStarted:
+            messageDisplay.show("The brush catches fire!");
+            break;
+        case StepEventType::PlayerHit:
+            if (e.value == 1) messageDisplay.show("Player " + std::to_string(e.player) + " is burning!");
+            else messageDisplay.show("Player " + std::to_string(e.player) + " hit by explosion!");
+            break;
+        case StepEventType::RiddleAsked:
+            interactions.showRiddle(*static_cast<const Riddle*>(e.object), e.player);
+            break;
+        case StepEventType::RiddleAnswered:
+            interactions.showRiddleResult(e.extra != 0);
+            break;
+        case StepEventType::RiddleClosed:
+            interactions.clearRiddle();
+            break;
+        default:
+            // Life loss, screen changes and game end have no in-level output
+            break;
+        }
+    }
+}
+
+
 // Render level, UI elements, and players (skipped in silent mode)
 void GameLevel::render() {
     // Skip rendering in silent mode
@@ -609,6 +691,8 @@ void GameLevel::render() {
         return;
     }
     
+    if (lighting.update() && !needsFullRedraw) renderer.redrawVisibilityChanges();
+
     if (needsFullRedraw) {
         renderer.drawBoard();
         statusBar.setDarkRoomStatus(lighting.getIsDarkRoom(), lighting.isRoomLit());
@@ -627,23 +711,23 @@ void GameLevel::render() {
     }
 
     // Shrapnel particles
-    for (const auto& p : shrapnelParticles) {
-        if (p.active) {
-            int x = p.pos.getX();
-            int y = p.pos.getY();
-            bool isVisible = !lighting.getIsDarkRoom() || lighting.isCellVisible(x, y);
-            if (isVisible) {
-                gotoxy(x, y);
-                ::setColor(Color::LightRed);
-                std::cout << p.sym;
-                resetColor();
-            }
+    for (int i = 0; i < particles.size(); i++) {
+        if (!particles.isAlive(i)) continue;
+        int x = particles.getPos(i).getX();
+        int y = particles.getPos(i).getY();
+        bool isVisible = !lighting.getIsDarkRoom() || lighting.isCellVisible(x, y);
+        if (isVisible) {
+            gotoxy(x, y);
+            ::setColor(particles.getColor(particles.getEmitter(i)));
+            std::cout << particles.getSymbol(i);
+            resetColor();
         }
     }
 
     // Draw players unless they've exited
-    if (player1 && !player1CrossedDoor) player1->draw();
-    if (player2 && !player2CrossedDoor) player2->draw();
+    for (const auto& mover : movement.getMovers()) {
+        if (!mover.finished) mover.player->draw();
+    }
     messageDisplay.draw();
 
     if (pauseMenu.getIsPaused()) pauseMenu.draw();
@@ -668,42 +752,49 @@ void GameLevel::addRiddle(std::unique_ptr<Riddle> riddle) {
 }
 
 // Heart spawn system - spawn at random empty position
-void GameLevel::spawnHeart() {
+bool GameLevel::spawnHeart() {
+    if (!random) return false;
+
     int attempts = 0;
     int x, y;
 
     do {
-        x = 2 + rand() % (GameConfig::GAME_WIDTH - 4);
-        y = 2 + rand() % (GameConfig::GAME_HEIGHT - 4);
+        x = 2 + random->nextInt(GameConfig::GAME_WIDTH - 4);
+        y = 2 + random->nextInt(GameConfig::GAME_HEIGHT - 4);
         attempts++;
     } while (!isValidHeartPosition(x, y) && attempts < 100);
 
     if (attempts < 100) {
         heart.setPosition(x, y);
-        heart.resetTimer();
         heart.activate();
         heartActive = true;
+        return true;
     }
+    return false;
 }
 
-void GameLevel::despawnHeart() {
+void GameLevel::removeHeart(StepEvents& events) {
     if (heartActive) {
-        if (!silentMode) {
-            gotoxy(heart.getX(), heart.getY());
-            std::cout << ' ';
-        }
+        events.push(StepEvent(StepEventType::CellChanged, 0, heart.getPosition()));
         heartActive = false;
-        heartRespawnTimer = HEART_RESPAWN_DELAY;
     }
 }
 
-// Update heart timer and handle respawn
-void GameLevel::updateHeart() {
-    if (heartActive) {
-        if (heart.updateTimer()) despawnHeart();
-    } else {
-        if (heartRespawnTimer > 0) heartRespawnTimer--;
-        else spawnHeart();
+// Picked up or blown up: the respawn delay starts over
+void GameLevel::despawnHeart(StepEvents& events) {
+    if (!heartActive) return;
+    removeHeart(events);
+    heartSequence = sequencer.start(heartCycle());
+}
+
+// Wait out the respawn delay, spawn (retrying every cycle until a free cell turns up),
+// stay for the heart's lifetime, vanish, repeat
+Sequence GameLevel::heartCycle() {
+    for (;;) {
+        co_await cycles(HEART_RESPAWN_DELAY + 1);
+        while (!spawnHeart()) co_await cycles(1);
+        co_await cycles(Heart::LIFETIME_CYCLES);
+        removeHeart(stepEvents);
     }
 }
 
@@ -718,116 +809,119 @@ bool GameLevel::isValidHeartPosition(int x, int y) const {
 }
 
 // AI-written: Bomb countdown and chain reaction explosion system
-// Detects bombs in explosion radius, accelerates their timers, preserves them
-// during initial blast, then activates chain reactions with reduced fuse time.
-// Uses position tracking sets to prevent double-activation.
-void GameLevel::updateBombs() {
+// Detonations pop from a (cycle, bomb) queue in bomb order. Each blast finds the bombs in
+// its square through the bomb cell index: idle ones join the chain, ticking ones are
+// hurried to their last tick. Live bombs are never destroyed by a blast.
+void GameLevel::updateBombs(StepEvents& events) {
     int displayCountdown = 0;
-    std::vector<Point> chainReactionPositions;
-    std::set<Point> activatedPositions;
+    int cycle = detonations.beginCycle();
+    auto& bombs = objects.getBombs();
 
-    for (auto& bomb : objects.getBombs()) {
-        if (bomb->isActiveCountdown()) {
-            int ticks = bomb->getCountdown();
-            if (ticks > 0 && (displayCountdown == 0 || ticks < displayCountdown)) {
-                displayCountdown = ticks;
-            }
+    // Tick every countdown; bombs reaching zero detonate this cycle
+    for (int i = 0; i < (int)bombs.size(); i++) {
+        Bomb& bomb = *bombs[i];
+        if (!bomb.isActiveCountdown()) continue;
 
-            if (bomb->updateCountdown()) {
-                Point explosionOrigin = bomb->getPosition();
-                spawnShrapnel(explosionOrigin);
-
-                std::vector<Point> affected = bomb->getExplosionArea(&board);
-
-                // Build list of positions in explosion radius
-                std::vector<Point> chainReactionPositionsToCheck;
-                int radius = bomb->getExplosionRadius();
-                Point bombPos = bomb->getPosition();
-                for (int dy = -radius; dy <= radius; dy++) {
-                    for (int dx = -radius; dx <= radius; dx++) {
-                        if (dx == 0 && dy == 0) continue;
-                        int tx = bombPos.getX() + dx;
-                        int ty = bombPos.getY() + dy;
-                        if (tx >= 1 && ty >= 1 && tx < GameConfig::GAME_WIDTH - 1 && ty < GameConfig::GAME_HEIGHT - 1) {
-                            chainReactionPositionsToCheck.push_back(Point(tx, ty));
-                        }
-                    }
-                }
+        int ticks = bomb.getCountdown();
+        if (ticks > 0 && (displayCountdown == 0 || ticks < displayCountdown)) {
+            displayCountdown = ticks;
+        }
+        if (bomb.updateCountdown()) {
+            detonations.schedule(i, cycle);
+        }
+    }
 
-                // Check for other bombs in blast zone
-                std::vector<Point> preservePositionsForThisBomb;
-                std::vector<Point> chainReactionForThisBomb;
-
-                for (auto& otherBomb : objects.getBombs()) {
-                    if (otherBomb.get() == bomb.get()) continue;
-                    
-                    Point otherBombPos = otherBomb->getPosition();
-                    
-                    bool withinRadius = false;
-                    for (const Point& checkPos : chainReactionPositionsToCheck) {
-                        if (otherBombPos == checkPos) {
-                            withinRadius = true;
-                            break;
-                        }
-                    }
-                    
-                    if (withinRadius && activatedPositions.find(otherBombPos) == activatedPositions.end()) {
-                        if (otherBomb->isIdle()) {
-                            preservePositionsForThisBomb.push_back(otherBombPos);
-                            chainReactionForThisBomb.push_back(otherBombPos);
-                            activatedPositions.insert(otherBombPos);
-                        } else if (otherBomb->isActivated() && otherBomb->isActiveCountdown() && otherBomb->getCountdown() > 1) {
-                            preservePositionsForThisBomb.push_back(otherBombPos);
-                            while (otherBomb->getCountdown() > 1) {
-                                otherBomb->updateCountdown();
-                            }
-                            activatedPositions.insert(otherBombPos);
-                        }
-                    }
-                }
+    std::vector<int> chainReactionBombs;
+    int exploding;
+    while (detonations.popDue(exploding)) {
+        Bomb& bomb = *bombs[exploding];
+        if (!bomb.isActivated()) continue;
 
-                bomb->explode(&board, &objects, player1, player2, affected, preservePositionsForThisBomb);
-                needsFullRedraw = true;
+        spawnShrapnel(bomb.getPosition());
+        BoardMask area = bomb.getBlastMask(&board);
+        reachBombsInBlast(exploding, cycle, chainReactionBombs);
 
-                if (!LivesManager::hasLivesRemaining()) {
-                    result = ScreenResult::GameOver;
-                }
+        // Brush in the blast catches fire instead of being blown away
+        BoardMask ignited = fire.ignite(area);
+        if (!ignited.none()) {
+            events.push(StepEvent(StepEventType::FireStarted, 0, bomb.getPosition()));
+        }
+        bomb.explode(&board, &objects, player1, player2, area, ignited);
+        objects.removeExplodedBomb(exploding);
+        events.push(StepEvent(StepEventType::FullRedraw));
 
-                chainReactionPositions.insert(chainReactionPositions.end(), 
-                    chainReactionForThisBomb.begin(), chainReactionForThisBomb.end());
-            }
+        if (!detached && !LivesManager::hasLivesRemaining()) {
+            result = ScreenResult::GameOver;
         }
     }
-    
+
     // Activate chain reaction bombs
-    if (!chainReactionPositions.empty()) {
-        int activatedCount = 0;
-        for (const Point& pos : chainReactionPositions) {
-            for (auto& bomb : objects.getBombs()) {
-                if (bomb->isIdle() && bomb->getPosition() == pos) {
-                    bomb->activate(pos);
-                    while (bomb->getCountdown() > 3) {
-                        bomb->updateCountdown();
+    int activatedCount = 0;
+    for (int i : chainReactionBombs) {
+        Bomb& bomb = *bombs[i];
+        if (!bomb.isIdle()) continue;
+        bomb.activate(bomb.getPosition());
+        while (bomb.getCountdown() > 3) {
+            bomb.updateCountdown();
+        }
+        activatedCount++;
+    }
+    if (activatedCount > 0) {
+        events.push(StepEvent(StepEventType::ChainReaction, 0, Point(), activatedCount));
+    }
+
+    bombCountdown = displayCountdown;
+}
+
+// Bombs in a blast square (walls do not stop the chain). The first bomb on a cell that
+// the blast can affect claims the cell for the rest of the cycle.
+void GameLevel::reachBombsInBlast(int exploding, int cycle, std::vector<int>& chainReactionBombs) {
+    auto& bombs = objects.getBombs();
+    const Bomb& source = *bombs[exploding];
+    int radius = source.getExplosionRadius();
+    Point origin = source.getPosition();
+
+    for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            Point pos(origin.getX() + dx, origin.getY() + dy);
+            if (!source.isInBlastSquare(pos)) continue;
+            int cell = pos.getY() * GameConfig::GAME_WIDTH + pos.getX();
+
+            for (int i = objects.firstBombAt(pos); i >= 0; i = objects.nextBombInCell(i)) {
+                if (detonations.isCellReached(cell)) break;
+                Bomb& other = *bombs[i];
+
+                if (other.isIdle()) {
+                    chainReactionBombs.push_back(i);
+                    detonations.markCellReached(cell);
+                }
+                else if (other.isActivated()) {
+                    // Later bombs in bomb order are hurried before their own tick this cycle
+                    bool tickPending = i > exploding;
+                    int countdown = other.getCountdown() + (tickPending ? 1 : 0);
+                    if (countdown <= 1) continue;
+
+                    while (other.getCountdown() > 1) {
+                        other.updateCountdown();
+                    }
+                    if (tickPending) {
+                        other.updateCountdown();
+                        detonations.schedule(i, cycle);
+                    } else {
+                        detonations.schedule(i, cycle + 1);
                     }
-                    activatedCount++;
-                    break;
+                    detonations.markCellReached(cell);
                 }
             }
         }
-        if (activatedCount > 0) {
-            messageDisplay.show("Chain reaction! " + std::to_string(activatedCount) + " bomb(s) activated!");
-        }
     }
-
-    statusBar.setBombCountdown(displayCountdown);
 }
 
 // Spawn shrapnel particles in 8 directions from explosion
+// Each blast gets its own emitter, so concurrent explosions all animate
 void GameLevel::spawnShrapnel(const Point& origin) {
-    shrapnelParticles.clear();
-
     struct DirSym { int dx; int dy; char sym; };
-    DirSym rays[] = {
+    static const DirSym rays[] = {
         {-1,  0, '-'}, { 1,  0, '-'},
         { 0, -1, '|'}, { 0,  1, '|'},
         { 1, -1, '/'}, {-1,  1, '/'},
@@ -835,142 +929,139 @@ void GameLevel::spawnShrapnel(const Point& origin) {
         { 1,  0, ','}, {-1, 0, ','},
         { 0,  1, ','}, { 0, -1, ','},
     };
+    const int rayCount = sizeof(rays) / sizeof(rays[0]);
+    static_assert(rayCount == SHRAPNEL_RAYS, "init() sizes the particle pool by SHRAPNEL_RAYS");
 
-    for (const auto& r : rays) {
-        ShrapnelParticle p;
-        p.pos = origin;
-        p.prevPos = origin;
-        p.origin = origin;
-        p.dx = r.dx;
-        p.dy = r.dy;
-        p.sym = r.sym;
-        p.stepsLeft = SHRAPNEL_MAX_STEPS;
-        p.active = true;
-        shrapnelParticles.push_back(p);
+    int emitter = particles.addEmitter(origin, Color::LightRed, rayCount);
+    if (emitter >= 0) {
+        for (const auto& r : rays) {
+            particles.spawn(emitter, r.dx, r.dy, r.sym, SHRAPNEL_MAX_STEPS);
+        }
     }
 
     board.setCell(origin, GameConfig::CHAR_EMPTY);
 }
 
 // AI-written: Shrapnel animation with per-explosion player damage tracking
-// Particles move outward destroying objects, damaging players once per explosion
-// (tracked via explosionPlayerHits map), respecting visibility in dark rooms.
-// Cleans up particles and tracking data when explosions complete.
-void GameLevel::updateShrapnel() {
-    if (shrapnelParticles.empty()) return;
-
-    auto isVisible = [&](int x, int y) {
-        return !lighting.getIsDarkRoom() || lighting.isCellVisible(x, y);
-    };
+// Particles move outward destroying objects, damaging each player once per explosion
+// (bit per player in the emitter's hit mask), respecting visibility in dark rooms.
+// Dead particles are swap-removed; an explosion's emitter is freed with its last particle.
+void GameLevel::updateShrapnel(StepEvents& events) {
+    if (particles.empty()) return;
 
-    for (auto& p : shrapnelParticles) {
-        if (!p.active) continue;
+    for (int i = 0; i < particles.size(); i++) {
+        if (!particles.isAlive(i)) continue;
 
-        renderer.drawCell(p.prevPos.getX(), p.prevPos.getY());
+        events.push(StepEvent(StepEventType::CellChanged, 0, particles.getPrevPos(i)));
 
-        if (p.stepsLeft <= 0) {
-            p.active = false;
+        if (particles.getStepsLeft(i) <= 0) {
+            particles.kill(i);
             continue;
         }
 
-        int nx = p.pos.getX() + p.dx;
-        int ny = p.pos.getY() + p.dy;
-        p.prevPos = p.pos;
-        p.pos.set(nx, ny);
-        p.stepsLeft--;
+        particles.advance(i);
+        Point pos = particles.getPos(i);
+        int nx = pos.getX();
+        int ny = pos.getY();
 
-        if (!p.pos.isInBounds()) {
-            p.active = false;
-            renderer.drawCell(p.prevPos.getX(), p.prevPos.getY());
+        if (!pos.isInBounds()) {
+            particles.kill(i);
+            events.push(StepEvent(StepEventType::CellChanged, 0, particles.getPrevPos(i)));
             continue;
         }
 
         char cell = board.getCell(nx, ny);
         bool isBorder = (nx == 0 || ny == 0 || nx == GameConfig::GAME_WIDTH - 1 || ny == GameConfig::GAME_HEIGHT - 1);
         if (isBorder && cell == GameConfig::CHAR_WALL) {
-            p.active = false;
-            renderer.drawCell(p.prevPos.getX(), p.prevPos.getY());
-            renderer.drawCell(nx, ny);
+            particles.kill(i);
+            events.push(StepEvent(StepEventType::CellChanged, 0, particles.getPrevPos(i)));
+            events.push(StepEvent(StepEventType::CellChanged, 0, pos));
             continue;
         }
 
-        bool isAtOrigin = (p.pos.getX() == p.origin.getX() && p.pos.getY() == p.origin.getY());
-        
-        // Damage players (once per explosion, tracked via map)
+        int emitter = particles.getEmitter(i);
+        bool isAtOrigin = (pos == particles.getOrigin(emitter));
+
+        // Damage players (once per explosion, tracked in the emitter's hit mask)
         if (!isAtOrigin) {
-            auto hitPlayer = [&](Player* player, const char* label, int playerNum) {
-                if (player && player->getPosition() == p.pos) {
-                    auto& hitPlayers = explosionPlayerHits[p.origin];
-                    if (hitPlayers.find(player) == hitPlayers.end()) {
-                        Player::subtractLife();
-                        hitPlayers.insert(player);
-                        messageDisplay.show(std::string(label) + " hit by explosion!");
-                        // Record life lost
-                        if (game) {
-                            game->getRecorder().recordLifeLost(playerNum);
-                        }
-                        if (!LivesManager::hasLivesRemaining()) {
-                            result = ScreenResult::GameOver;
-                        }
+            auto hitPlayer = [&](Player* player, int playerNum) {
+                if (!detached && player && player->getPosition() == pos) {
+                    if (particles.markHit(emitter, playerNum - 1)) {
+                        damagePlayer(playerNum, pos, false, events);
                     }
                     return true;
                 }
                 return false;
             };
 
-            hitPlayer(player1, "Player 1", 1) || hitPlayer(player2, "Player 2", 2);
+            hitPlayer(player1, 1) || hitPlayer(player2, 2);
             if (result == ScreenResult::GameOver) {
-                p.active = false;
+                particles.kill(i);
                 continue;
             }
         }
 
+        // Shrapnel sets brush alight; burning tiles are left to the fire
+        if (cell == GameConfig::CHAR_BRUSH) {
+            if (fire.ignite(pos)) events.push(StepEvent(StepEventType::FireStarted, 0, pos));
+            continue;
+        }
+        if (cell == GameConfig::CHAR_FIRE) continue;
+
         // Destroy objects (doors are protected)
         bool isDoor = (cell >= '1' && cell <= '9');
         if (cell != GameConfig::CHAR_EMPTY && cell != ' ' && !isDoor) {
-            objects.destroyAt(p.pos);
-            if (heartActive && heart.getPosition() == p.pos) despawnHeart();
-            board.setCell(p.pos, GameConfig::CHAR_EMPTY);
+            objects.destroyAt(pos);
+            if (heartActive && heart.getPosition() == pos) despawnHeart(events);
+            board.setCell(pos, GameConfig::CHAR_EMPTY);
         }
     }
 
     // Cleanup inactive particles
-    bool hadParticles = !shrapnelParticles.empty();
-    std::set<Point> completedExplosions;
-    
-    auto it = shrapnelParticles.begin();
-    while (it != shrapnelParticles.end()) {
-        if (!it->active) {
-            completedExplosions.insert(it->origin);
-            renderer.drawCell(it->pos.getX(), it->pos.getY());
-            renderer.drawCell(it->prevPos.getX(), it->prevPos.getY());
-            it = shrapnelParticles.erase(it);
-        } else {
-            ++it;
-        }
+    particles.removeDead([&](int i) {
+        events.push(StepEvent(StepEventType::CellChanged, 0, particles.getPos(i)));
+        events.push(StepEvent(StepEventType::CellChanged, 0, particles.getPrevPos(i)));
+    });
+
+    if (particles.empty()) {
+        events.push(StepEvent(StepEventType::FullRedraw));
     }
-    
-    // Clear tracking for finished explosions
-    for (const Point& origin : completedExplosions) {
-        bool hasActiveParticles = false;
-        for (const auto& particle : shrapnelParticles) {
-            if (particle.active && particle.origin == origin) {
-                hasActiveParticles = true;
-                break;
-            }
-        }
-        if (!hasActiveParticles) {
-            explosionPlayerHits.erase(origin);
-        }
+}
+
+// Shared damage path for shrapnel and fire: one life, PlayerHit + LifeLost, game over check
+void GameLevel::damagePlayer(int playerNum, const Point& pos, bool burned, StepEvents& events) {
+    Player::subtractLife();
+    events.push(StepEvent(StepEventType::PlayerHit, playerNum, pos, burned ? 1 : 0));
+    events.push(StepEvent(StepEventType::LifeLost, playerNum, pos));
+    if (!LivesManager::hasLivesRemaining()) {
+        result = ScreenResult::GameOver;
     }
-    
-    if (hadParticles && shrapnelParticles.empty()) {
-        needsFullRedraw = true;
+}
+
+// Advance the fire automaton one generation and redraw the tiles that changed
+void GameLevel::updateFire(StepEvents& events) {
+    BoardMask changed;
+    if (!fire.update(changed)) return;
+    for (const Point& p : changed.toPoints()) {
+        events.push(StepEvent(StepEventType::CellChanged, 0, p));
+    }
+}
+
+// Standing in fire costs a life, then the player has a short grace period to get out
+void GameLevel::burnPlayersInFire(StepEvents& events) {
+    Player* players[2] = { player1, player2 };
+    for (int i = 0; i < 2; i++) {
+        if (burnCooldown[i] > 0) burnCooldown[i]--;
+        if (!players[i] || burnCooldown[i] > 0 || result == ScreenResult::GameOver) continue;
+        if (!fire.isBurning(players[i]->getPosition())) continue;
+
+        burnCooldown[i] = BURN_HIT_COOLDOWN;
+        damagePlayer(i + 1, players[i]->getPosition(), true, events);
     }
 }
 
 // Handle spring compression on entry and release on direction change
-void GameLevel::handleSpringInteraction(Player& player, Player* otherPlayer) {
+void GameLevel::handleSpringInteraction(Player& player, StepEvents& events) {
     Point pos = player.getPosition();
     Spring* spring = objects.getSpringAt(pos);
 
@@ -985,7 +1076,7 @@ void GameLevel::handleSpringInteraction(Player& player, Player* otherPlayer) {
                 Spring::ReleaseInfo info = spring->release();
                 if (info.released) {
                     player.setSpringMomentum(info.direction, info.speed, info.duration);
-                    messageDisplay.show("Spring launched! Speed: " + std::to_string(info.speed));
+                    events.push(StepEvent(StepEventType::SpringLaunched, playerNumber(player), pos, info.speed));
                 }
             } else {
                 spring->onPlayerMove(&player, pos, dir);
@@ -993,7 +1084,7 @@ void GameLevel::handleSpringInteraction(Player& player, Player* otherPlayer) {
         }
 
         spring->updateBoard(&board);
-        needsFullRedraw = true;
+        events.push(StepEvent(StepEventType::FullRedraw));
     }
     else {
         // Exited spring area - release if still compressing
@@ -1005,49 +1096,8 @@ void GameLevel::handleSpringInteraction(Player& player, Player* otherPlayer) {
                 }
                 spr->onPlayerExit(&player);
                 spr->updateBoard(&board);
-                needsFullRedraw = true;
+                events.push(StepEvent(StepEventType::FullRedraw));
             }
         }
     }
 }
-
-// AI-assisted: Cooperative obstacle pushing with combined force calculation
-// Checks if other player is adjacent or facing same direction within grace period
-// to combine pushing force. Spring momentum adds extra force.
-bool GameLevel::tryPushObstacle(Player& player, Player* otherPlayer, Direction dir) {
-    Point nextPos = player.getPosition().getNextPosition(dir);
-    Obstacle* obstacle = objects.getObstacleAt(nextPos);
-
-    if (!obstacle) return false;
-
-    int force = player.getForce();
-
-    // Check if other player can help push
-    if (otherPlayer) {
-        Point otherPos = otherPlayer->getPosition();
-        int dx = std::abs(player.getPosition().getX() - otherPos.getX());
-        int dy = std::abs(player.getPosition().getY() - otherPos.getY());
-
-        bool playersAdjacent = (dx == 1 && dy == 0) || (dx == 0 && dy == 1);
-        Point otherNextPos = otherPos.getNextPosition(dir);
-        bool otherAdjacentToObstacle = obstacle->containsPoint(otherNextPos);
-        
-        if (playersAdjacent || otherAdjacentToObstacle) {
-            // 5-cycle grace period for coordination
-            bool sameDirection = (otherPlayer->getDirection() == dir);
-            bool recentlySameDirection = (otherPlayer->getLastMoveDirection() == dir && 
-                                          otherPlayer->getLastMoveAge() <= 5);
-            
-            if (sameDirection || recentlySameDirection) {
-                force += otherPlayer->getForce();
-            }
-        }
-    }
-
-    if (obstacle->canPush(dir, &board, force)) {
-        obstacle->push(dir, &board, force);
-        return true;
-    }
-
-    return false;
-}
@@ -8,29 +8,39 @@
 #include "ObjectManager.h"
 #include "LightingSystem.h"
 #include "CollisionSystem.h"
+#include "MovementSystem.h"
 #include "InteractionHandler.h"
 #include "InputHandler.h"
 #include "LevelRenderer.h"
+#include "DetonationQueue.h"
+#include "ParticleSystem.h"
+#include "FireSystem.h"
+#include "EventBus.h"
+#include "Sequence.h"
 #include "StatusBar.h"
 #include "MessageDisplay.h"
 #include "PauseMenu.h"
 #include "Heart.h"
+#include "GameRandom.h"
+#include "LevelStep.h"
+#include <atomic>
 #include <string>
 #include <vector>
-#include <map>
-#include <set>
-#include <cstdlib>
-#include <ctime>
 
 class GameRecorder;  // Forward declaration
 
 class GameLevel : public BaseScreen {
 private:
+    // Level clock for timed sequences (declared first so it outlives every sequence)
+    Sequencer sequencer;
+
     // Game systems
     GameBoard board;
     ObjectManager objects;
     LightingSystem lighting;
+    FireSystem fire;
     CollisionSystem collision;
+    MovementSystem movement;
     InteractionHandler interactions;
     InputHandler input;
     LevelRenderer renderer;
@@ -43,6 +53,8 @@ private:
     ScreenResult result;
     bool needsFullRedraw;
     bool silentMode;
+    bool detached;  // Players left while timers were running; kept as is until they return
+    std::atomic<bool> prepared;  // Restored and composed ahead of time by the preloader
 
     // Players (owned by Game class)
     Player* player1;
@@ -51,45 +63,97 @@ private:
     // Game reference for riddle tracking
     Game* game;
 
-    // Door crossing tracking
-    bool player1CrossedDoor;
-    bool player2CrossedDoor;
+    // Session random generator (owned by Game)
+    GameRandom* random;
+
+    // Door crossing (per-mover finished flags live in MovementSystem)
     int doorTargetScreen;  // Target screen from the door players used
 
-    // Heart spawn system
+    // Input collected by handleInput, consumed by the next step
+    InputFrame pendingInput;
+
+    // Riddle modal, advanced by the step like everything else: Asking holds the asking
+    // player until an answer arrives in their input, Feedback shows the result until
+    // riddleFeedback closes it. The rest of the level keeps running throughout.
+    enum class RiddlePhase { None, Asking, Feedback };
+    struct PendingRiddle {
+        RiddlePhase phase;
+        Riddle* riddle;
+        int playerNum;
+        Point pos;
+
+        PendingRiddle() : phase(RiddlePhase::None), riddle(nullptr), playerNum(0) {}
+    };
+    PendingRiddle pendingRiddle;
+    Sequence riddleFeedback;
+    static const int RIDDLE_CORRECT_CYCLES = 15;  // feedback shown about 1.5 seconds
+    static const int RIDDLE_WRONG_CYCLES = 20;    // about 2 seconds
+
+    // Shortest active bomb countdown (shown in the status bar)
+    int bombCountdown;
+
+    // Pending bomb detonations, resolved in (cycle, bomb) order
+    DetonationQueue detonations;
+
+    // Heart spawn system (heartSequence runs the respawn delay and lifetime)
     Heart heart;
     bool heartActive;
-    int heartRespawnTimer;
+    Sequence heartSequence;
     static const int HEART_RESPAWN_DELAY = 30;  // about 3 seconds
 
-    struct ShrapnelParticle {
-        Point pos;
-        Point prevPos;
-        Point origin;  // Where the bomb was placed (immune position)
-        int dx;
-        int dy;
-        char sym;
-        int stepsLeft;
-        bool active;
-    };
-    std::vector<ShrapnelParticle> shrapnelParticles;
+    // Shrapnel (and other short effects), one emitter per explosion
+    ParticleSystem particles;
     static const int SHRAPNEL_MAX_STEPS = 4;  // Match explosion radius
-    
-    // Track which players have been hit by each explosion (key = origin point)
-    std::map<Point, std::set<Player*>> explosionPlayerHits;
+    static const int SHRAPNEL_RAYS = 12;      // Particles per explosion
+
+    // Cycles before standing in fire costs a player another life
+    int burnCooldown[2];
+    static const int BURN_HIT_COOLDOWN = 10;  // about 1 second
+
+    // Per-visit state (door flags, riddle, pause, messages) shared by reset and resume
+    void resetVisit();
 
-    // Helper methods
-    void handlePlayerMovement(Player& player, Player* otherPlayer);
+    // Level contents back to their initial state: objects, board, fire, timers, fog
+    void restore();
+
+    // Simulation helpers (mutate level state, report changes as events)
+    int playerNumber(const Player& player) const;
+    void applyPlayerInput(Player* player, const PlayerInput& cmd, StepEvents& events);
+    void handlePlayerMovement(Mover& mover, StepEvents& events);
     bool checkBothPlayersOnDoor() const;
-    void spawnHeart();
-    void despawnHeart();
-    void updateHeart();
+    bool spawnHeart();
+    void removeHeart(StepEvents& events);
+    void despawnHeart(StepEvents& events);
     bool isValidHeartPosition(int x, int y) const;
-    void updateBombs();
+    void updateBombs(StepEvents& events);
+    void reachBombsInBlast(int exploding, int cycle, std::vector<int>& chainReactionBombs);
     void spawnShrapnel(const Point& origin);
-    void updateShrapnel();
-    void handleSpringInteraction(Player& player, Player* otherPlayer);
-    bool tryPushObstacle(Player& player, Player* otherPlayer, Direction dir);
+    void updateShrapnel(StepEvents& events);
+    void damagePlayer(int playerNum, const Point& pos, bool burned, StepEvents& events);
+    void updateFire(StepEvents& events);
+    void burnPlayersInFire(StepEvents& events);
+    void handleSpringInteraction(Player& player, StepEvents& events);
+    bool isAnsweringRiddle(int playerNum) const;
+    void updateRiddle(const InputFrame& frame, StepEvents& events);
+    void resolveRiddle(char answer, StepEvents& events);
+
+    // Timed sequences (resumed by sequencer.tick() in the step)
+    Sequence heartCycle();
+    Sequence closeRiddleAfter(int feedbackCycles);
+
+    // Events of the last step (buffer reused every cycle) and where they go afterwards:
+    // the console presenter (not subscribed in silent mode) and the game's recorder
+    StepEvents stepEvents;
+    EventBus eventBus;
+
+    struct Presenter : public EventConsumer {
+        GameLevel& level;
+        explicit Presenter(GameLevel& l) : level(l) {}
+        void onEvents(const StepEvents& batch) override { level.presentEvents(batch); }
+    };
+    Presenter presenter;
+
+    void presentEvents(const StepEvents& events);
 
 public:
     GameLevel(int num = 1);
@@ -97,6 +161,7 @@ public:
     // Setup
     void setPlayers(Player* p1, Player* p2);
     void setGame(Game* g);
+    void setRandom(GameRandom* rng);
     void setSilentMode(bool silent);
 
     // Add objects
@@ -109,7 +174,7 @@ public:
     void addVerticalDoor(int x, int y, int length, char doorNum, int targetScreen = -1);
     void addGate(int x, int y, int width, int height, char doorNum);
     void addLightSwitch(int x, int y, bool startOn = false);
-    void addSwitch(int x, int y, char linkedGate, bool startOn = false);
+    void addSwitch(int x, int y, const std::string& linkedGates, bool startOn = false);
     void addTorch(int x, int y, int radius = 5);
     void addRiddle(int x, int y, const std::string& question,
         const std::vector<std::string>& options, char correctAnswer);
@@ -119,12 +184,21 @@ public:
     void addCoin(int x, int y);
     void addObstacleCell(int x, int y);
     void addSpringCell(int x, int y);
+    void addBrush(int x, int y);
+
+    // Switch wiring (read when init builds the signal graph)
+    void setGateLogic(char doorNum, SignalLogic logic);
+    void setLightLogic(SignalLogic logic);
 
     // Dark room settings
     void setDarkRoom(bool dark);
     bool getIsDarkRoom() const;
     void setTorchRadius(int radius);
 
+    // Fog of war (explored cells, one mask per row)
+    std::vector<BoardRowMask> getExploredRows() const;
+    void setExploredRows(const std::vector<BoardRowMask>& rows);
+
     // Screen interface
     void init() override;
     void enter() override;
@@ -135,6 +209,29 @@ public:
     void render() override;
     ScreenResult getResult() const override;
 
+    // Simulation core: advance one cycle without any console, timing or recorder I/O.
+    // A player being asked a riddle stands still; their answer comes in the frame.
+    // The returned events stay valid until the next step.
+    const StepEvents& step(const InputFrame& frame);
+    bool hasPendingRiddle() const;
+    bool isPaused() const;
+
+    // Background rooms: a room left with bombs ticking, shrapnel flying or fire
+    // burning keeps running without the players until it settles
+    bool hasPendingActivity() const;
+    void leave();
+    bool isDetached() const;
+    void stepBackground();  // Bombs, shrapnel and fire only; nothing drawn or recorded
+    void resume();          // Players come back to the room as it is now
+
+    // Door-target preloading: prepare() does the restore half of reset() and composes
+    // the first frame. It touches nothing outside this level (no players, console or
+    // recorder), so the preloader runs it on its worker while another level is played.
+    void prepare();
+    bool isPrepared() const;
+    void enterPrepared();   // The rest of reset(), when the players arrive
+    std::vector<int> getDoorTargetScreens() const;
+
     int getLevelNumber() const;
     int getDoorTargetScreen() const;  // Get target screen from door players used
 
@@ -0,0 +1,66 @@
+// GameRandom.cpp - xoshiro128** generator for deterministic gameplay randomness
+
+#include "GameRandom.h"
+
+GameRandom::GameRandom() {
+    seed(0);
+}
+
+GameRandom::GameRandom(uint32_t seedValue) {
+    seed(seedValue);
+}
+
+uint32_t GameRandom::rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// Expand a 32-bit seed into the full state with splitmix32 (never all zero)
+void GameRandom::seed(uint32_t seedValue) {
+    uint32_t z = seedValue;
+    for (int i = 0; i < 4; i++) {
+        z += 0x9E3779B9u;
+        uint32_t t = z;
+        t = (t ^ (t >> 16)) * 0x85EBCA6Bu;
+        t = (t ^ (t >> 13)) * 0xC2B2AE35u;
+        state.s[i] = t ^ (t >> 16);
+    }
+}
+
+const GameRandom::State& GameRandom::getState() const {
+    return state;
+}
+
+void GameRandom::setState(const State& s) {
+    state = s;
+}
+
+uint32_t GameRandom::next() {
+    const uint32_t result = rotl(state.s[1] * 5, 7) * 9;
+    const uint32_t t = state.s[1] << 9;
+
+    state.s[2] ^= state.s[0];
+    state.s[3] ^= state.s[1];
+    state.s[1] ^= state.s[2];
+    state.s[0] ^= state.s[3];
+    state.s[2] ^= t;
+    state.s[3] = rotl(state.s[3], 11);
+
+    return result;
+}
+
+// Lemire's multiply-shift with rejection for an unbiased range
+int GameRandom::nextInt(int bound) {
+    if (bound <= 1) return 0;
+
+    uint32_t range = static_cast<uint32_t>(bound);
+    uint64_t m = static_cast<uint64_t>(next()) * range;
+    uint32_t low = static_cast<uint32_t>(m);
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            m = static_cast<uint64_t>(next()) * range;
+            low = static_cast<uint32_t>(m);
+        }
+    }
+    return static_cast<int>(m >> 32);
+}
@@ -0,0 +1,36 @@
+// GameRandom.h - Explicitly seeded random generator owned by a game session
+// xoshiro128** core with splitmix32 seeding, so a replay can restore the exact state
+
+#pragma once
+
+#include <cstdint>
+
+class GameRandom {
+public:
+    // Full generator state (stored in the steps file for bit-exact playback)
+    struct State {
+        uint32_t s[4];
+    };
+
+private:
+    State state;
+
+    static uint32_t rotl(uint32_t x, int k);
+
+public:
+    GameRandom();
+    explicit GameRandom(uint32_t seedValue);
+
+    // Seeding
+    void seed(uint32_t seedValue);
+
+    // State access for recording/playback
+    const State& getState() const;
+    void setState(const State& s);
+
+    // Raw 32-bit output
+    uint32_t next();
+
+    // Uniform integer in [0, bound) without modulo bias
+    int nextInt(int bound);
+};
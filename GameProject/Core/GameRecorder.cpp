@@ -2,18 +2,23 @@
 // Records inputs to steps file, events to result file, and replays for testing
 
 #include "GameRecorder.h"
+#include "Riddle.h"
 #include <iostream>
 #include <sstream>
 #include <ctime>
 #include <algorithm>
 
 const std::string GameRecorder::STEPS_FILE = "adv-world.steps";
+// 2: riddles are answered inside the level step and their feedback lasts game cycles,
+// so a format 1 file with riddle answers would replay differently
+const int GameRecorder::STEPS_FORMAT = 2;
 const std::string GameRecorder::RESULT_FILE = "adv-world.result";
 
 GameRecorder::GameRecorder()
     : mode(GameMode::Normal), silentMode(false),
-      randomSeed(0), currentStepIndex(0), riddleAnswerIndex(0),
-      currentCycle(0), riddleIndex(0) {
+      randomSeed(0), randomState(GameRandom(0).getState()), currentStepIndex(0),
+      currentCycle(0), cycleZeroTime(std::chrono::steady_clock::now()), inputTimeUs(-1),
+      riddleIndex(0) {
 }
 
 // Set recording/playback mode
@@ -40,7 +45,7 @@ const std::vector<std::string>& GameRecorder::getScreenFiles() const {
 // Set/get random seed for deterministic playback
 void GameRecorder::setRandomSeed(unsigned int seed) {
     randomSeed = seed;
-    srand(seed);
+    randomState = GameRandom(seed).getState();
 }
 
 unsigned int GameRecorder::getRandomSeed() const {
@@ -48,8 +53,16 @@ unsigned int GameRecorder::getRandomSeed() const {
 }
 
 void GameRecorder::initializeRandomSeed() {
-    randomSeed = static_cast<unsigned int>(time(nullptr));
-    srand(randomSeed);
+    setRandomSeed(static_cast<unsigned int>(time(nullptr)));
+}
+
+// Generator state the recorded game starts from
+void GameRecorder::setRandomState(const GameRandom::State& state) {
+    randomState = state;
+}
+
+const GameRandom::State& GameRecorder::getRandomState() const {
+    return randomState;
 }
 
 // Riddle question tracking for deterministic replay
@@ -75,7 +88,22 @@ void GameRecorder::resetRiddleIndex() {
 // Game cycle counter
 void GameRecorder::nextCycle() { currentCycle++; }
 int GameRecorder::getCurrentCycle() const { return currentCycle; }
-void GameRecorder::resetCycle() { currentCycle = 0; }
+void GameRecorder::resetCycle() {
+    currentCycle = 0;
+    cycleZeroTime = std::chrono::steady_clock::now();
+}
+
+// Key timestamps
+void GameRecorder::setInputTime(std::chrono::steady_clock::time_point pressed) {
+    inputTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(pressed - cycleZeroTime).count();
+}
+
+void GameRecorder::clearInputTime() { inputTimeUs = -1; }
+
+void GameRecorder::pushStep(GameStep step) {
+    step.timeUs = inputTimeUs;
+    steps.push_back(step);
+}
 
 // Convert direction to file character
 std::string GameRecorder::directionToChar(Direction dir) const {
@@ -117,7 +145,7 @@ void GameRecorder::recordStep(int player, Direction dir) {
     step.cycle = currentCycle;
     step.player = player;
     step.action = directionToChar(dir)[0];
-    steps.push_back(step);
+    pushStep(step);
 }
 
 void GameRecorder::recordStop(int player) {
@@ -127,7 +155,7 @@ void GameRecorder::recordStop(int player) {
     step.cycle = currentCycle;
     step.player = player;
     step.action = 'S';
-    steps.push_back(step);
+    pushStep(step);
 }
 
 void GameRecorder::recordDispose(int player) {
@@ -137,7 +165,7 @@ void GameRecorder::recordDispose(int player) {
     step.cycle = currentCycle;
     step.player = player;
     step.action = (player == 1) ? 'E' : 'O';  // Player 1 uses E, Player 2 uses O
-    steps.push_back(step);
+    pushStep(step);
 }
 
 void GameRecorder::recordRiddleAnswer(int player, char answer) {
@@ -150,7 +178,7 @@ void GameRecorder::recordRiddleAnswer(int player, char answer) {
     // 'a'/'A' -> '1', 'b'/'B' -> '2', 'c'/'C' -> '3', 'd'/'D' -> '4'
     char lowerAnswer = static_cast<char>(std::tolower(answer));
     step.action = static_cast<char>('1' + (lowerAnswer - 'a'));
-    steps.push_back(step);
+    pushStep(step);
 }
 
 void GameRecorder::recordScreenChange(int player, int newScreen) {
@@ -197,9 +225,31 @@ void GameRecorder::recordGameEnd(int score, bool victory) {
     actualEvents.push_back(event);
 }
 
-// Check if action code is a riddle answer (1-4)
-static bool isRiddleAnswerAction(char action) {
-    return action == '1' || action == '2' || action == '3' || action == '4';
+// Result events from the bus
+const StepEventMask GameRecorder::RECORDED_EVENTS =
+    eventBit(StepEventType::LifeLost) | eventBit(StepEventType::RiddleAnswered) |
+    eventBit(StepEventType::ScreenChanged) | eventBit(StepEventType::GameEnded);
+
+void GameRecorder::onEvents(const StepEvents& events) {
+    for (const StepEvent& e : events) {
+        switch (e.type) {
+        case StepEventType::LifeLost:
+            recordLifeLost(e.player);
+            break;
+        case StepEventType::RiddleAnswered:
+            recordRiddle(e.player, static_cast<const Riddle*>(e.object)->getQuestion(),
+                         static_cast<char>(e.value), e.extra != 0);
+            break;
+        case StepEventType::ScreenChanged:
+            recordScreenChange(e.player, e.value);
+            break;
+        case StepEventType::GameEnded:
+            recordGameEnd(e.value, e.extra != 0);
+            break;
+        default:
+            break;
+        }
+    }
 }
 
 // Parse steps file for playback
@@ -211,12 +261,12 @@ bool GameRecorder::loadStepsFile() {
     }
     
     steps.clear();
-    riddleAnswerSteps.clear();
     screenFiles.clear();
     riddleQuestions.clear();
     currentStepIndex = 0;
-    riddleAnswerIndex = 0;
     riddleIndex = 0;
+    int format = 1;
+    bool hasRiddleAnswers = false;
     
     std::string line;
     while (std::getline(file, line)) {
@@ -226,6 +276,11 @@ bool GameRecorder::loadStepsFile() {
         if (line.empty() || line[0] == '#') continue;
         
         // Parse header info
+        if (line.find("format:") == 0) {
+            format = std::stoi(trim(line.substr(7)));
+            continue;
+        }
+        
         if (line.find("screens:") == 0) {
             std::string files = trim(line.substr(8));
             std::istringstream iss(files);
@@ -236,9 +291,18 @@ bool GameRecorder::loadStepsFile() {
             continue;
         }
         
+        // Seed alone (older files) derives the state; rng_state overrides it
         if (line.find("seed:") == 0) {
-            randomSeed = std::stoul(trim(line.substr(5)));
-            srand(randomSeed);
+            setRandomSeed(static_cast<unsigned int>(std::stoul(trim(line.substr(5)))));
+            continue;
+        }
+        
+        if (line.find("rng_state:") == 0) {
+            std::istringstream iss(trim(line.substr(10)));
+            std::string word;
+            for (int i = 0; i < 4 && std::getline(iss, word, ','); i++) {
+                randomState.s[i] = static_cast<uint32_t>(std::stoul(trim(word)));
+            }
             continue;
         }
         
@@ -262,16 +326,23 @@ bool GameRecorder::loadStepsFile() {
         if (std::getline(iss, token, ',')) step.cycle = std::stoi(trim(token));
         if (std::getline(iss, token, ',')) step.player = std::stoi(trim(token));
         if (std::getline(iss, token, ',')) step.action = trim(token)[0];
+        if (std::getline(iss, token, ',')) step.timeUs = std::stoll(trim(token));
         
-        // Separate riddle answers from movement steps
-        if (isRiddleAnswerAction(step.action)) {
-            riddleAnswerSteps.push_back(step);
-        } else {
-            steps.push_back(step);
-        }
+        // Riddle answers ('1'-'4') are ordinary steps of the cycle they were given in
+        if (step.action >= '1' && step.action <= '4') hasRiddleAnswers = true;
+        steps.push_back(step);
     }
     
     file.close();
+    
+    if (format > STEPS_FORMAT || (format < 2 && hasRiddleAnswers)) {
+        std::cerr << "Error: " << STEPS_FILE << " is in steps format " << format
+                  << " (expected " << STEPS_FORMAT << ")";
+        if (format < 2) std::cerr << "; its riddle answers would not replay the same, record it again";
+        std::cerr << std::endl;
+        steps.clear();
+        return false;
+    }
     return true;
 }
 
@@ -354,23 +425,6 @@ char GameRecorder::getInputForPlayer(int player) {
     return '\0';  // No input for this player this cycle
 }
 
-// Get recorded riddle answer for player
-char GameRecorder::getRiddleAnswer(int player) {
-    if (!isLoadMode()) return '\0';
-    
-    // Get the next riddle answer from the separate queue
-    if (riddleAnswerIndex < riddleAnswerSteps.size()) {
-        const GameStep& step = riddleAnswerSteps[riddleAnswerIndex];
-        if (step.player == player) {
-            riddleAnswerIndex++;
-            // Convert '1'-'4' back to 'a'-'d'
-            char answer = static_cast<char>('a' + (step.action - '1'));
-            return answer;
-        }
-    }
-    return '\0';  // No riddle answer found
-}
-
 // Write recorded steps to file
 bool GameRecorder::saveStepsFile() {
     std::ofstream file(STEPS_FILE);
@@ -381,9 +435,11 @@ bool GameRecorder::saveStepsFile() {
     
     // Write header
     file << "# adv-world.steps - Game recording file\n";
-    file << "# Format: cycle,player,action\n";
+    file << "# Format: cycle,player,action[,time_us]\n";
     file << "# Actions: U=up, D=down, L=left, R=right, S=stop, E/O=dispose, 1/2/3/4=riddle answer (a/b/c/d)\n";
+    file << "# time_us: when the key was pressed, microseconds since cycle 0 (ignored on playback)\n";
     file << "\n";
+    file << "format: " << STEPS_FORMAT << "\n";
     
     // Write screen files used
     file << "screens: ";
@@ -395,6 +451,8 @@ bool GameRecorder::saveStepsFile() {
     
     // Write random seed
     file << "seed: " << randomSeed << "\n";
+    file << "rng_state: " << randomState.s[0] << "," << randomState.s[1] << ","
+         << randomState.s[2] << "," << randomState.s[3] << "\n";
     
     // Write riddle questions in order they appear
     file << "riddles: " << riddleQuestions.size() << "\n";
@@ -406,7 +464,9 @@ bool GameRecorder::saveStepsFile() {
     // Write steps
     file << "# Steps (cycle, player, action)\n";
     for (const auto& step : steps) {
-        file << step.cycle << "," << step.player << "," << step.action << "\n";
+        file << step.cycle << "," << step.player << "," << step.action;
+        if (step.timeUs >= 0) file << "," << step.timeUs;
+        file << "\n";
     }
     
     file.close();
@@ -515,12 +575,10 @@ void GameRecorder::printVerificationReport() const {
 // Reset all recorded data
 void GameRecorder::clear() {
     steps.clear();
-    riddleAnswerSteps.clear();
     actualEvents.clear();
     expectedEvents.clear();
     riddleQuestions.clear();
     currentStepIndex = 0;
-    riddleAnswerIndex = 0;
     riddleIndex = 0;
     currentCycle = 0;
 }
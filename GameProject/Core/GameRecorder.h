@@ -7,7 +7,10 @@
 #include <vector>
 #include <fstream>
 #include <map>
+#include <chrono>
 #include "Direction.h"
+#include "GameRandom.h"
+#include "EventBus.h"
 
 // Game execution modes
 enum class GameMode {
@@ -22,6 +25,7 @@ struct GameStep {
     int cycle;          // Game cycle when input occurred
     int player;         // 1 or 2
     char action;        // 'U','D','L','R','S' (directions/stop), 'E'/'O' (dispose), or '1'-'4' (riddle answer a-d)
+    long long timeUs = -1;  // When the key was pressed, microseconds since cycle 0 (-1 = unknown)
 };
 
 // Game event for results file
@@ -32,7 +36,7 @@ struct GameEvent {
     std::string data;   // Additional event-specific data
 };
 
-class GameRecorder {
+class GameRecorder : public EventConsumer {
 private:
     // Mode
     GameMode mode;
@@ -41,20 +45,19 @@ private:
     // File paths
     static const std::string STEPS_FILE;
     static const std::string RESULT_FILE;
+    static const int STEPS_FORMAT;  // Written as "format:"; files without it are format 1
     
     // Screen files used in this session
     std::vector<std::string> screenFiles;
     
-    // Random seed for reproducibility
+    // Random seed and generator state at game start (for bit-exact replay)
     unsigned int randomSeed;
+    GameRandom::State randomState;
     
     // Recorded/loaded steps (movement only)
     std::vector<GameStep> steps;
     size_t currentStepIndex;
     
-    // Riddle answers stored separately for clean handling
-    std::vector<GameStep> riddleAnswerSteps;
-    size_t riddleAnswerIndex;
     
     // Recorded events (actual)
     std::vector<GameEvent> actualEvents;
@@ -64,6 +67,12 @@ private:
     
     // Current game cycle
     int currentCycle;
+
+    // Key timestamps: the clock at cycle 0 and the press time of the key being recorded
+    std::chrono::steady_clock::time_point cycleZeroTime;
+    long long inputTimeUs;
+
+    void pushStep(GameStep step);
     
     // Riddle questions in order they appear (for reproducibility)
     std::vector<std::string> riddleQuestions;
@@ -93,6 +102,8 @@ public:
     void setRandomSeed(unsigned int seed);
     unsigned int getRandomSeed() const;
     void initializeRandomSeed();
+    void setRandomState(const GameRandom::State& state);
+    const GameRandom::State& getRandomState() const;
     
     // Riddle question management (for exact reproducibility)
     void addRiddleQuestion(const std::string& question);
@@ -104,6 +115,10 @@ public:
     void nextCycle();
     int getCurrentCycle() const;
     void resetCycle();
+
+    // Press time of the key whose steps are recorded next (sub-cycle timing for latency analysis)
+    void setInputTime(std::chrono::steady_clock::time_point pressed);
+    void clearInputTime();
     
     // Recording (save mode)
     void recordStep(int player, Direction dir);
@@ -116,6 +131,10 @@ public:
                       char answer, bool correct);
     void recordGameEnd(int score, bool victory);
     
+    // Result events arrive through the event bus (subscribed in save and load modes)
+    static const StepEventMask RECORDED_EVENTS;
+    void onEvents(const StepEvents& events) override;
+    
     // Playback (load mode)
     bool loadStepsFile();
     bool loadResultFile();
@@ -128,8 +147,6 @@ public:
     // Get input for current cycle (returns '\0' if none)
     char getInputForPlayer(int player);
     
-    // Get riddle answer for playback (returns the recorded answer, or '\0' if none)
-    char getRiddleAnswer(int player);
     
     // File operations
     bool saveStepsFile();
@@ -127,6 +127,45 @@ std::string GameStateSaver::charListToString(const std::vector<char>& chars) {
     return oss.str();
 }
 
+// Row masks as hex, one row per ';' group ("0f00...;...")
+// Hex digit i holds columns 4i..4i+3, lowest column in the lowest bit
+std::string GameStateSaver::rowMasksToString(const std::vector<BoardRowMask>& rows) {
+    static const char digits[] = "0123456789abcdef";
+    std::string result;
+    for (size_t y = 0; y < rows.size(); y++) {
+        if (y > 0) result += ';';
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x += 4) {
+            int nibble = 0;
+            for (int b = 0; b < 4 && x + b < GameConfig::GAME_WIDTH; b++) {
+                if (rows[y][x + b]) nibble |= 1 << b;
+            }
+            result += digits[nibble];
+        }
+    }
+    return result;
+}
+
+std::vector<BoardRowMask> GameStateSaver::parseRowMasks(const std::string& str) {
+    std::vector<BoardRowMask> rows;
+    if (str.empty()) return rows;
+
+    std::istringstream iss(str);
+    std::string hex;
+    while (std::getline(iss, hex, ';')) {
+        BoardRowMask row;
+        for (int i = 0; i < (int)hex.size() && i * 4 < GameConfig::GAME_WIDTH; i++) {
+            char c = hex[i];
+            int nibble = (c >= '0' && c <= '9') ? c - '0' :
+                         (c >= 'a' && c <= 'f') ? c - 'a' + 10 : 0;
+            for (int b = 0; b < 4 && i * 4 + b < GameConfig::GAME_WIDTH; b++) {
+                if (nibble & (1 << b)) row.set(i * 4 + b);
+            }
+        }
+        rows.push_back(row);
+    }
+    return rows;
+}
+
 // Save game state to file
 bool GameStateSaver::saveGameState(const SavedGameState& state) {
     std::string filename = generateFilename();
@@ -156,6 +195,7 @@ bool GameStateSaver::saveGameState(const SavedGameState& state) {
     file << "collected_coins=" << pointListToString(state.collectedCoins) << "\n";
     file << "opened_gates=" << charListToString(state.openedGates) << "\n";
     file << "solved_riddles=" << pointListToString(state.solvedRiddles) << "\n";
+    file << "explored=" << rowMasksToString(state.exploredRows) << "\n";
     
     file.close();
     return true;
@@ -200,6 +240,7 @@ bool GameStateSaver::loadGameState(const std::string& filename, SavedGameState&
             else if (key == "collected_coins") state.collectedCoins = parsePointList(value);
             else if (key == "opened_gates") state.openedGates = parseCharList(value);
             else if (key == "solved_riddles") state.solvedRiddles = parsePointList(value);
+            else if (key == "explored") state.exploredRows = parseRowMasks(value);
         }
     }
     
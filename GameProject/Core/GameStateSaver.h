@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "GameBoard.h"
 #include <string>
 #include <vector>
 
@@ -37,6 +38,7 @@ struct SavedGameState {
     std::vector<std::pair<int, int>> collectedCoins;
     std::vector<char> openedGates;
     std::vector<std::pair<int, int>> solvedRiddles;
+    std::vector<BoardRowMask> exploredRows;  // Fog of war of the current level (empty = none)
     
     SavedGameState();
 };
@@ -54,6 +56,8 @@ private:
     static std::string pointListToString(const std::vector<std::pair<int, int>>& points);
     static std::vector<char> parseCharList(const std::string& str);
     static std::string charListToString(const std::vector<char>& chars);
+    static std::vector<BoardRowMask> parseRowMasks(const std::string& str);
+    static std::string rowMasksToString(const std::vector<BoardRowMask>& rows);
 
 public:
     // Save current game state to a new file
@@ -0,0 +1,120 @@
+// LatencyTracker.cpp - Latency samples, nearest-rank percentiles and reports
+
+#include "LatencyTracker.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+const std::string LatencyTracker::REPORT_FILE = "adv-world.latency";
+
+static const char* const STAGE_NAMES[LatencyTracker::STAGE_COUNT] = { "input", "step", "frame" };
+
+LatencyTracker::LatencyTracker() : stepped(0), discarded(0) {
+}
+
+long long LatencyTracker::elapsedUs(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+void LatencyTracker::keyHandled(int playerNum, Clock::time_point keyTime) {
+    Sample s;
+    s.player = playerNum;
+    s.keyTime = keyTime;
+    s.stageUs[Input] = elapsedUs(keyTime, Clock::now());
+    s.stageUs[Step] = s.stageUs[Frame] = 0;
+    inFlight.push_back(s);
+}
+
+// Every key drained so far went into the frame this step just applied
+void LatencyTracker::stepApplied() {
+    if (stepped == inFlight.size()) return;
+    Clock::time_point now = Clock::now();
+    for (size_t i = stepped; i < inFlight.size(); i++) {
+        inFlight[i].stageUs[Step] = elapsedUs(inFlight[i].keyTime, now);
+    }
+    stepped = inFlight.size();
+}
+
+// Applied keys are complete; keys drained after the last step wait for the next frame
+void LatencyTracker::framePresented() {
+    if (stepped == 0) return;
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < stepped; i++) {
+        inFlight[i].stageUs[Frame] = elapsedUs(inFlight[i].keyTime, now);
+        done.push_back(inFlight[i]);
+    }
+    inFlight.erase(inFlight.begin(), inFlight.begin() + stepped);
+    stepped = 0;
+}
+
+void LatencyTracker::discardPending() {
+    discarded += (int)inFlight.size();
+    inFlight.clear();
+    stepped = 0;
+}
+
+LatencyTracker::Percentiles LatencyTracker::getPercentiles(Stage stage) const {
+    Percentiles p;
+    p.samples = done.size();
+    if (done.empty()) return p;
+
+    std::vector<long long> values;
+    values.reserve(done.size());
+    for (const auto& s : done) values.push_back(s.stageUs[stage]);
+    std::sort(values.begin(), values.end());
+
+    // Nearest rank: smallest value with at least pct% of samples at or below it
+    auto rank = [&values](int pct) {
+        size_t n = (values.size() * pct + 99) / 100;
+        return values[n > 0 ? n - 1 : 0];
+    };
+    p.p50 = rank(50);
+    p.p90 = rank(90);
+    p.p99 = rank(99);
+    p.max = values.back();
+    return p;
+}
+
+void LatencyTracker::printSummary() const {
+    if (done.empty()) return;
+    std::cout << "Input latency over " << done.size() << " key(s), ms p50/p90/p99/max:" << std::endl;
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        Percentiles p = getPercentiles(static_cast<Stage>(s));
+        std::cout << "  " << STAGE_NAMES[s] << ": "
+                  << p.p50 / 1000.0 << " / " << p.p90 / 1000.0 << " / "
+                  << p.p99 / 1000.0 << " / " << p.max / 1000.0 << std::endl;
+    }
+    if (discarded > 0) {
+        std::cout << "  " << discarded << " key(s) never reached a frame" << std::endl;
+    }
+}
+
+bool LatencyTracker::saveReport() const {
+    if (done.empty()) return true;
+
+    std::ofstream file(REPORT_FILE);
+    if (!file.is_open()) {
+        std::cerr << "Error: Cannot create " << REPORT_FILE << std::endl;
+        return false;
+    }
+
+    file << "# adv-world.latency - Keypress to screen latency (microseconds since the key was read)\n";
+    file << "# Stages: input = drained by the game, step = applied by a level step,\n";
+    file << "#         frame = first rendered frame after that step\n";
+    file << "# Format: stage,samples,p50,p90,p99,max\n";
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        Percentiles p = getPercentiles(static_cast<Stage>(s));
+        file << STAGE_NAMES[s] << "," << p.samples << "," << p.p50 << ","
+             << p.p90 << "," << p.p99 << "," << p.max << "\n";
+    }
+    file << "discarded," << discarded << "\n";
+    file << "\n";
+    file << "# Format: key,player,input,step,frame\n";
+    for (const auto& s : done) {
+        file << "key," << s.player << "," << s.stageUs[Input] << ","
+             << s.stageUs[Step] << "," << s.stageUs[Frame] << "\n";
+    }
+
+    file.close();
+    return true;
+}
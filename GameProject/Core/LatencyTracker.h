@@ -0,0 +1,58 @@
+// LatencyTracker.h - Keypress-to-screen latency for one play session
+// Every player key carries the monotonic time it was read. The tracker follows it
+// through three points - drained by InputHandler, applied by the level step, shown by
+// the first rendered frame after that step - and reports percentiles of each.
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+class LatencyTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Stages, each measured from the moment the key was read
+    enum Stage { Input = 0, Step, Frame, STAGE_COUNT };
+
+    struct Percentiles {
+        size_t samples;
+        long long p50, p90, p99, max;  // Microseconds
+
+        Percentiles() : samples(0), p50(0), p90(0), p99(0), max(0) {}
+    };
+
+private:
+    struct Sample {
+        int player;
+        Clock::time_point keyTime;
+        long long stageUs[STAGE_COUNT];
+    };
+
+    std::vector<Sample> inFlight;  // Keys not yet on screen
+    size_t stepped;                // inFlight[0..stepped) have been applied by a step
+    std::vector<Sample> done;
+    int discarded;                 // Keys dropped before reaching a frame (pause, exit)
+
+    static long long elapsedUs(Clock::time_point from, Clock::time_point to);
+
+public:
+    LatencyTracker();
+
+    // Pipeline points (all cheap; called every tick)
+    void keyHandled(int playerNum, Clock::time_point keyTime);
+    void stepApplied();
+    void framePresented();
+    void discardPending();  // In-flight keys will never reach a frame
+
+    size_t getSampleCount() const { return done.size(); }
+    int getDiscarded() const { return discarded; }
+    Percentiles getPercentiles(Stage stage) const;
+
+    // Reports (nothing is printed or written when there are no samples)
+    void printSummary() const;
+    bool saveReport() const;
+
+    static const std::string REPORT_FILE;
+};
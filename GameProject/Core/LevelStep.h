@@ -0,0 +1,129 @@
+// LevelStep.h - Data passed into and out of GameLevel::step
+// InputFrame carries one cycle of player commands; StepEvents lists what the cycle changed
+
+#pragma once
+
+#include "Point.h"
+#include "Direction.h"
+#include <vector>
+#include <cstdint>
+
+class GameObject;
+
+// Commands for one player in one cycle (applied in this order: direction, stop, dispose).
+// A riddle answer ('a'-'d') only counts while that player is being asked a riddle.
+struct PlayerInput {
+    bool hasDirection;
+    Direction direction;
+    bool stop;
+    bool dispose;
+    char answer;
+
+    PlayerInput() : hasDirection(false), direction(Direction::STAY), stop(false), dispose(false), answer('\0') {}
+
+    // Fold a later command into this one (a later direction cancels an earlier stop)
+    void setDirection(Direction dir) {
+        hasDirection = true;
+        direction = dir;
+        stop = false;
+    }
+    void setStop() { stop = true; }
+    void setDispose() { dispose = true; }
+    void setAnswer(char a) { answer = a; }
+
+    bool isEmpty() const { return !hasDirection && !stop && !dispose && answer == '\0'; }
+};
+
+// All input for one simulation cycle
+struct InputFrame {
+    PlayerInput player1;
+    PlayerInput player2;
+};
+
+// Something the simulation changed that rendering, recording or UI may care about
+enum class StepEventType {
+    // Rendering
+    CellChanged,          // pos: board cell to redraw
+    PlayerMoved,          // player, pos: cell the player left
+    TorchMoved,           // player, pos: new torch holder position
+    GateOpened,           // pos: gate corner, value/extra: width/height (opened with key)
+    FullRedraw,
+    StatusChanged,        // inventory, lives or coins changed
+
+    // Messages
+    NeedKey,
+    GateUnlocked,         // all linked switches on
+    GateLocked,           // linked switch turned off
+    SwitchToggled,        // value: 1 = on
+    LightToggled,         // value: 1 = on
+    ItemPickedUp,         // player, value: item char
+    ItemDropped,          // player, value: item char
+    SpringLaunched,       // player, value: speed
+    MomentumTransferred,
+    ChainReaction,        // value: bombs activated
+    FireStarted,          // player (0 = bomb), pos: where it caught
+    RiddleAsked,          // player, pos: riddle cell, object: riddle
+    RiddleClosed,         // feedback time is over (or the riddle was destroyed)
+    LifeGained,           // player
+
+    // Recorded
+    PlayerHit,            // player hit by explosion, value: 1 = burned by fire (a LifeLost follows)
+    LifeLost,             // player
+    RiddleAnswered,       // player, value: answer, extra: 1 = correct, object: riddle
+    ScreenChanged,        // value: new screen number (1-based); raised by Game
+    GameEnded,            // value: score, extra: 1 = victory; raised by Game
+
+    Count
+};
+
+// One bit per event type, so consumers can say what they want and a batch can say what it holds
+using StepEventMask = uint64_t;
+static_assert(static_cast<int>(StepEventType::Count) <= 64, "StepEventMask needs a bit per type");
+
+inline StepEventMask eventBit(StepEventType t) {
+    return StepEventMask(1) << static_cast<int>(t);
+}
+
+struct StepEvent {
+    StepEventType type;
+    int player;                 // 1 or 2 (0 if N/A)
+    Point pos;
+    int value;
+    int extra;
+    const GameObject* object;
+
+    StepEvent(StepEventType t, int p = 0, const Point& at = Point(), int v = 0, int e = 0,
+              const GameObject* obj = nullptr)
+        : type(t), player(p), pos(at), value(v), extra(e), object(obj) {}
+};
+
+// Ordered list of events produced by one step. Owners reuse one buffer across
+// steps (clear keeps the capacity), so steady-state steps do not allocate.
+class StepEvents {
+private:
+    std::vector<StepEvent> events;
+    StepEventMask types;  // Every type pushed since the last clear
+
+public:
+    StepEvents() : types(0) {}
+
+    void push(const StepEvent& e) {
+        events.push_back(e);
+        types |= eventBit(e.type);
+    }
+    void append(const StepEvents& other) {
+        events.insert(events.end(), other.events.begin(), other.events.end());
+        types |= other.types;
+    }
+    void clear() {
+        events.clear();
+        types = 0;
+    }
+
+    StepEventMask getTypes() const { return types; }
+
+    bool empty() const { return events.empty(); }
+    size_t size() const { return events.size(); }
+    std::vector<StepEvent>::const_iterator begin() const { return events.begin(); }
+    std::vector<StepEvent>::const_iterator end() const { return events.end(); }
+};
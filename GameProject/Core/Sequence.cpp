@@ -0,0 +1,109 @@
+// Sequence.cpp - Frame pool, sequence ownership and the cycle wake queue
+
+#include "Sequence.h"
+#include <new>
+
+// Frame pool: power-of-two size classes from 64 to 1024 bytes. Freed blocks go on a
+// per-class free list and are reused; chunks are never handed back, so a level that
+// keeps restarting the same few sequences stops allocating after the first ones.
+// Free lists are per thread (the level preloader restarts sequences on its worker);
+// a block freed on another thread than it came from simply joins that thread's list.
+namespace {
+    const std::size_t MIN_BLOCK = 64;
+    const int CLASS_COUNT = 5;          // 64, 128, 256, 512, 1024
+    const int BLOCKS_PER_CHUNK = 16;
+
+    struct FreeBlock { FreeBlock* next; };
+    thread_local FreeBlock* freeLists[CLASS_COUNT] = {};
+
+    int sizeClass(std::size_t size) {
+        std::size_t block = MIN_BLOCK;
+        for (int c = 0; c < CLASS_COUNT; c++, block *= 2) {
+            if (size <= block) return c;
+        }
+        return -1;  // Too big for the pool
+    }
+
+    void refill(int c) {
+        std::size_t block = MIN_BLOCK << c;
+        char* chunk = static_cast<char*>(::operator new(block * BLOCKS_PER_CHUNK));
+        for (int i = 0; i < BLOCKS_PER_CHUNK; i++) {
+            FreeBlock* b = reinterpret_cast<FreeBlock*>(chunk + i * block);
+            b->next = freeLists[c];
+            freeLists[c] = b;
+        }
+    }
+}
+
+void* FramePool::allocate(std::size_t size) {
+    int c = sizeClass(size);
+    if (c < 0) return ::operator new(size);
+    if (!freeLists[c]) refill(c);
+    FreeBlock* b = freeLists[c];
+    freeLists[c] = b->next;
+    return b;
+}
+
+void FramePool::release(void* block, std::size_t size) {
+    int c = sizeClass(size);
+    if (c < 0) {
+        ::operator delete(block);
+        return;
+    }
+    FreeBlock* b = static_cast<FreeBlock*>(block);
+    b->next = freeLists[c];
+    freeLists[c] = b;
+}
+
+// Sequence
+Sequence& Sequence::operator=(Sequence&& other) noexcept {
+    if (this != &other) {
+        destroy();
+        handle = other.handle;
+        other.handle = nullptr;
+    }
+    return *this;
+}
+
+void Sequence::destroy() {
+    if (!handle) return;
+    Sequencer* sequencer = handle.promise().sequencer;
+    if (sequencer) sequencer->cancel(handle);
+    handle.destroy();
+    handle = nullptr;
+}
+
+// Sequencer
+Sequencer::Sequencer() : cycle(0) {
+}
+
+Sequence Sequencer::start(Sequence seq) {
+    if (seq.handle) {
+        seq.handle.promise().sequencer = this;
+        seq.handle.resume();
+    }
+    return seq;
+}
+
+void Sequencer::tick() {
+    cycle++;
+    while (!sleeping.empty() && sleeping.begin()->first <= cycle) {
+        Sequence::Handle h = sleeping.begin()->second;
+        sleeping.erase(sleeping.begin());
+        h.promise().asleep = false;
+        h.resume();
+    }
+}
+
+void Sequencer::sleep(Sequence::Handle h, int cycles) {
+    Sequence::promise_type& p = h.promise();
+    p.wake = sleeping.emplace(cycle + cycles, h);
+    p.asleep = true;
+}
+
+void Sequencer::cancel(Sequence::Handle h) {
+    Sequence::promise_type& p = h.promise();
+    if (!p.asleep) return;
+    sleeping.erase(p.wake);
+    p.asleep = false;
+}
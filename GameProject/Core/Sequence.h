@@ -0,0 +1,95 @@
+// Sequence.h - Coroutine sequences scheduled by the game tick
+// Multi-cycle behaviour (heart lifetime, riddle feedback, message timeouts) is written
+// as straight-line code that suspends with `co_await cycles(n)`. Sleeping sequences sit
+// in a wake-ordered queue, so a tick only touches the ones that are due. Coroutine
+// frames come from a small block pool instead of the general heap.
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <map>
+
+class Sequencer;
+
+// Fixed-size block pool for coroutine frames (free lists are per thread)
+class FramePool {
+public:
+    static void* allocate(std::size_t size);
+    static void release(void* block, std::size_t size);
+};
+
+// Owning handle to one running sequence; destroying or reassigning it cancels the
+// sequence wherever it is suspended
+class Sequence {
+public:
+    struct promise_type {
+        Sequencer* sequencer = nullptr;
+        bool asleep = false;
+        std::multimap<long long, std::coroutine_handle<promise_type>>::iterator wake;
+
+        Sequence get_return_object() {
+            return Sequence(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }  // Runs on Sequencer::start
+        std::suspend_always final_suspend() noexcept { return {}; }    // Freed by the owner
+        void return_void() {}
+        void unhandled_exception() { throw; }
+
+        static void* operator new(std::size_t size) { return FramePool::allocate(size); }
+        static void operator delete(void* block, std::size_t size) { FramePool::release(block, size); }
+    };
+    using Handle = std::coroutine_handle<promise_type>;
+
+private:
+    Handle handle;
+
+    explicit Sequence(Handle h) : handle(h) {}
+    void destroy();
+
+    friend class Sequencer;
+
+public:
+    Sequence() : handle(nullptr) {}
+    Sequence(Sequence&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    Sequence& operator=(Sequence&& other) noexcept;
+    Sequence(const Sequence&) = delete;
+    Sequence& operator=(const Sequence&) = delete;
+    ~Sequence() { destroy(); }
+
+    // Still has work left (started and not yet returned)
+    bool isRunning() const { return handle && !handle.done(); }
+};
+
+class Sequencer {
+private:
+    long long cycle;  // Ticks so far
+    std::multimap<long long, Sequence::Handle> sleeping;  // Wake cycle -> sequence (FIFO per cycle)
+
+public:
+    Sequencer();
+
+    // Run a new sequence up to its first wait; the returned handle owns it
+    Sequence start(Sequence seq);
+
+    // Advance one cycle and resume every sequence due at it, oldest wait first
+    void tick();
+
+    long long getCycle() const { return cycle; }
+    size_t getSleeping() const { return sleeping.size(); }
+
+    // Used by the awaiter and by Sequence when it is cancelled
+    void sleep(Sequence::Handle h, int cycles);
+    void cancel(Sequence::Handle h);
+};
+
+// `co_await cycles(n)` resumes the sequence n ticks later (n <= 0 does not suspend)
+struct CycleWait {
+    int count;
+
+    bool await_ready() const noexcept { return count <= 0; }
+    void await_suspend(Sequence::Handle h) const { h.promise().sequencer->sleep(h, count); }
+    void await_resume() const noexcept {}
+};
+
+inline CycleWait cycles(int count) { return CycleWait{ count }; }
@@ -0,0 +1,46 @@
+// TickScheduler.cpp - Absolute-deadline tick pacing with bounded catch-up
+
+#include "TickScheduler.h"
+#include <thread>
+
+TickScheduler::TickScheduler(int tickMs, int maxCatchUpTicks)
+    : tickLength(std::chrono::milliseconds(tickMs)),
+    maxCatchUp(maxCatchUpTicks < 1 ? 1 : maxCatchUpTicks),
+    deadline(Clock::now()),
+    overruns(0), skipped(0), worstLate(Clock::duration::zero()) {
+}
+
+void TickScheduler::reset() {
+    deadline = Clock::now();
+}
+
+int TickScheduler::waitForTicks() {
+    Clock::time_point now = Clock::now();
+    if (now < deadline) {
+        std::this_thread::sleep_until(deadline);
+        deadline += tickLength;
+        return 1;
+    }
+
+    // Late: every whole tick length past the deadline is another tick owed
+    Clock::duration late = now - deadline;
+    long long due = 1 + late / tickLength;
+    if (due > 1) {
+        overruns++;
+        if (late > worstLate) worstLate = late;
+    }
+
+    if (due > maxCatchUp) {
+        // Too far behind to catch up: run the cap and restart the timeline from now
+        skipped += due - maxCatchUp;
+        deadline = now + tickLength;
+        return maxCatchUp;
+    }
+
+    deadline += tickLength * due;
+    return (int)due;
+}
+
+long long TickScheduler::getWorstLateMs() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(worstLate).count();
+}
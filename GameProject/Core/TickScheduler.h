@@ -0,0 +1,36 @@
+// TickScheduler.h - Fixed-timestep pacing for the main loop
+// Ticks are due at absolute deadlines on a monotonic clock, so processing time is
+// absorbed by a shorter sleep instead of stretching every cycle. When the loop falls
+// behind it asks for several ticks at once (up to a cap) and counts the overrun.
+
+#pragma once
+
+#include <chrono>
+
+class TickScheduler {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration tickLength;
+    int maxCatchUp;
+    Clock::time_point deadline;  // When the next tick is due
+
+    // Overrun statistics
+    int overruns;        // Waits that found at least one whole tick already missed
+    long long skipped;   // Ticks dropped because the backlog exceeded the cap
+    Clock::duration worstLate;
+
+public:
+    TickScheduler(int tickMs, int maxCatchUpTicks);
+
+    // Next tick is due now (call when pacing starts or resumes after a pause)
+    void reset();
+
+    // Sleep until the next deadline and return how many ticks to run now:
+    // 1 when on time, more when catching up (capped; the rest is skipped)
+    int waitForTicks();
+
+    int getOverruns() const { return overruns; }
+    long long getSkippedTicks() const { return skipped; }
+    long long getWorstLateMs() const;
+};
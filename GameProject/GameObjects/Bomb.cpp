@@ -1,6 +1,6 @@
 // Bomb.cpp - Bomb item that explodes after countdown
 // Handles collection, activation, countdown, and explosion with wall shielding
-// AI usage: Raycast wall shielding (AI-assisted), explosion area calculation (AI-assisted),
+// AI usage: Raycast wall shielding (AI-assisted, now table-driven in ExplosionShield), explosion area calculation (AI-assisted),
 //           chain reaction explosion logic (AI-assisted)
 
 #include "Bomb.h"
@@ -8,9 +8,9 @@
 #include "ObjectManager.h"
 #include "Player.h"
 #include "GameConfig.h"
+#include "ExplosionShield.h"
 #include "console.h"
 #include <iostream>
-#include <cmath>
 
 // Default constructor - idle bomb
 Bomb::Bomb()
@@ -64,111 +64,57 @@ bool Bomb::updateCountdown() {
     return false;
 }
 
-// AI-assisted: Raycast from bomb to target to detect wall shielding
-// Steps along line checking each cell for walls
+// Wall shielding uses the precomputed integer ray for this offset
 bool Bomb::isShieldedByWall(const Point& target, GameBoard* board) const {
-    if (!board) return false;
-
-    int dx = target.getX() - position.getX();
-    int dy = target.getY() - position.getY();
-
-    // Step along the line from bomb to target
-    int absDx = (dx < 0) ? -dx : dx;
-    int absDy = (dy < 0) ? -dy : dy;
-    int steps = (absDx > absDy) ? absDx : absDy;
-    if (steps == 0) return false;
-
-    float stepX = (float)dx / steps;
-    float stepY = (float)dy / steps;
-
-    // Check each point along the ray for walls
-    for (int i = 1; i < steps; i++) {
-        int checkX = position.getX() + (int)(stepX * i + 0.5f);
-        int checkY = position.getY() + (int)(stepY * i + 0.5f);
-
-        char cell = board->getCell(checkX, checkY);
-        if (cell == 'W') {
-            return true;
-        }
-    }
+    return ExplosionShield::isShielded(board, position, target);
+}
 
-    return false;
+// Blast cells as row masks, built in one pass over the wall rows
+BoardMask Bomb::getBlastMask(const GameBoard* board) const {
+    return ExplosionShield::compute(board, position, explosionRadius);
 }
 
-// AI-assisted: Calculate explosion area excluding wall-shielded cells
+// Explosion area excluding wall-shielded cells, in row-major order
 std::vector<Point> Bomb::getExplosionArea(GameBoard* board) const {
-    std::vector<Point> affected;
-
-    for (int dy = -explosionRadius; dy <= explosionRadius; dy++) {
-        for (int dx = -explosionRadius; dx <= explosionRadius; dx++) {
-            if (dx == 0 && dy == 0) continue;  // skip bomb position
-
-            int tx = position.getX() + dx;
-            int ty = position.getY() + dy;
-
-            // Stay within playable area
-            if (tx < 1 || ty < 1 || tx >= GameConfig::GAME_WIDTH - 1 || ty >= GameConfig::GAME_HEIGHT - 1) continue;
-
-            int absDx = (dx < 0) ? -dx : dx;
-            int absDy = (dy < 0) ? -dy : dy;
-            if (absDx > explosionRadius || absDy > explosionRadius) continue;
-
-            Point target(tx, ty);
-
-            // Only add if not blocked by wall
-            if (!isShieldedByWall(target, board)) {
-                affected.push_back(target);
-            }
-        }
-    }
+    return getBlastMask(board).toPoints();
+}
 
-    return affected;
+// Chain reach ignores walls: any playable cell in the blast square except the bomb's own
+bool Bomb::isInBlastSquare(const Point& target) const {
+    int dx = target.getX() - position.getX();
+    int dy = target.getY() - position.getY();
+    if (dx == 0 && dy == 0) return false;
+    if (dx < -explosionRadius || dx > explosionRadius || dy < -explosionRadius || dy > explosionRadius) return false;
+    return target.getX() >= 1 && target.getY() >= 1 &&
+           target.getX() < GameConfig::GAME_WIDTH - 1 && target.getY() < GameConfig::GAME_HEIGHT - 1;
 }
 
-// Explode without preserve positions
+// Explode without preserved cells
 void Bomb::explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2) {
-    explode(board, objects, player1, player2, std::vector<Point>());
+    explode(board, objects, player1, player2, BoardMask());
 }
 
-// Explode with computed area and preserve list
-void Bomb::explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const std::vector<Point>& preservePositions) {
-    std::vector<Point> affected = getExplosionArea(board);
-    explode(board, objects, player1, player2, affected, preservePositions);
+// Explode with computed area
+void Bomb::explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const BoardMask& preserve) {
+    explode(board, objects, player1, player2, getBlastMask(board), preserve);
 }
 
-// AI-assisted: Main explosion - destroys objects while preserving chain reaction bombs
-// Checks preserve list and active bombs before destroying each cell
-void Bomb::explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const std::vector<Point>& affectedPositions, const std::vector<Point>& preservePositions) {
+// AI-assisted: Main explosion - destroys the whole area in one batch
+// Preserved cells and cells holding live bombs (chain reactions) are spared
+void Bomb::explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const BoardMask& area, const BoardMask& preserve) {
     if (!activated) return;
 
     // Player damage is handled by shrapnel in GameLevel for proper tracking
-    for (const Point& pos : affectedPositions) {
-        // Check if we should preserve this cell (chain reaction bomb there)
-        bool shouldPreserve = false;
-        for (const Point& preservePos : preservePositions) {
-            if (pos == preservePos) {
-                shouldPreserve = true;
-                break;
-            }
-        }
-
-        // Safety check for active bombs
-        if (!shouldPreserve && objects) {
-            for (auto& bomb : objects->getBombs()) {
-                if (bomb->getPosition() == pos && bomb->isActive()) {
-                    shouldPreserve = true;
-                    break;
-                }
-            }
-        }
-
-        // Destroy objects unless preserved
-        if (objects && !shouldPreserve) {
-            objects->destroyAt(pos);
-        }
+    BoardMask spared = preserve;
+    if (objects) {
+        spared |= objects->getLiveBombCells();
+        objects->destroyArea(area, spared);
+    }
 
-        // Clear cell but protect doors
-        if (board && !shouldPreserve) {
+    // Clear cells but protect doors
+    if (board) {
+        BoardMask hit = area - spared;
+        for (const Point& pos : hit.toPoints()) {
             char cell = board->getCell(pos);
             bool isDoor = (cell >= '1' && cell <= '9');
             if (!isDoor) {
@@ -9,6 +9,7 @@
 class GameBoard;
 class ObjectManager;
 class Player;
+struct BoardMask;
 
 class Bomb : public GameObject {
 private:
@@ -45,14 +46,18 @@ public:
     
     // Get positions affected by explosion (respecting wall shielding)
     std::vector<Point> getExplosionArea(GameBoard* board) const;
+    BoardMask getBlastMask(const GameBoard* board) const;
+    
+    // Check if a point lies in the blast square (walls do not stop chain reactions)
+    bool isInBlastSquare(const Point& target) const;
     
     // Check if a point is shielded from explosion by walls
     bool isShieldedByWall(const Point& target, GameBoard* board) const;
     
     // Perform explosion
     void explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2);
-    void explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const std::vector<Point>& preservePositions);
-    void explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const std::vector<Point>& affectedPositions, const std::vector<Point>& preservePositions);
+    void explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const BoardMask& preserve);
+    void explode(GameBoard* board, ObjectManager* objects, Player* player1, Player* player2, const BoardMask& area, const BoardMask& preserve);
     
     // Reset bomb to original state
     void reset();
@@ -5,14 +5,14 @@
 #include <iostream>
 
 // Constructors
-LightSwitch::LightSwitch() : GameObject(0, 0, 'S', Color::Yellow), isOn(false) {}
+LightSwitch::LightSwitch() : GameObject(0, 0, 'S', Color::Yellow), isOn(false), signalInput(-1) {}
 
 LightSwitch::LightSwitch(int x, int y, bool startOn)
-    : GameObject(x, y, 'S', startOn ? Color::LightGreen : Color::Yellow), isOn(startOn) {
+    : GameObject(x, y, 'S', startOn ? Color::LightGreen : Color::Yellow), isOn(startOn), signalInput(-1) {
 }
 
 LightSwitch::LightSwitch(const Point& pos, bool startOn)
-    : GameObject(pos, 'S', startOn ? Color::LightGreen : Color::Yellow), isOn(startOn) {
+    : GameObject(pos, 'S', startOn ? Color::LightGreen : Color::Yellow), isOn(startOn), signalInput(-1) {
 }
 
 // State
@@ -35,6 +35,10 @@ void LightSwitch::reset() {
     active = true;
 }
 
+// Signal graph
+int LightSwitch::getSignalInput() const { return signalInput; }
+void LightSwitch::setSignalInput(int id) { signalInput = id; }
+
 // Interaction
 bool LightSwitch::onInteract(Player& player) {
     toggle();
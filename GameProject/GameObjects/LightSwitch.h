@@ -10,6 +10,7 @@ class Player;
 class LightSwitch : public GameObject {
 private:
     bool isOn;
+    int signalInput;  // Input id in the level's signal graph (-1 = not wired)
 
 public:
     LightSwitch();
@@ -23,6 +24,10 @@ public:
     void turnOff();
     void reset();
 
+    // Signal graph
+    int getSignalInput() const;
+    void setSignalInput(int id);
+
     // Interaction
     bool onInteract(Player& player) override;
 
@@ -1,5 +1,5 @@
 // Obstacle.cpp - Multi-block pushable obstacles
-// Supports cooperative pushing with force calculation
+// Shapes are bit rows over the bounding box; pushes are shift-and-AND tests against the board
 // AI usage: Force-based pushing (AI-assisted), flood-fill grouping (AI-assisted)
 
 #include "Obstacle.h"
@@ -9,19 +9,51 @@
 #include <iostream>
 #include <algorithm>
 
-Obstacle::Obstacle() : GameObject(0, 0, '*', Color::Gray), size(0) {}
+Obstacle::Obstacle()
+    : GameObject(0, 0, '*', Color::Gray), top(0), left(0), right(-1), size(0),
+    originalTop(0), originalLeft(0), originalRight(-1) {}
 
-Obstacle::Obstacle(int x, int y) : GameObject(x, y, '*', Color::Gray), size(0) {
+Obstacle::Obstacle(int x, int y)
+    : GameObject(x, y, '*', Color::Gray), top(0), left(0), right(-1), size(0),
+    originalTop(0), originalLeft(0), originalRight(-1) {
     addBlock(x, y);
 }
 
+static void directionDelta(Direction dir, int& dx, int& dy) {
+    dx = 0;
+    dy = 0;
+    if (dir == Direction::UP) dy = -1;
+    else if (dir == Direction::DOWN) dy = 1;
+    else if (dir == Direction::LEFT) dx = -1;
+    else if (dir == Direction::RIGHT) dx = 1;
+}
+
 void Obstacle::addBlock(int x, int y) {
-    blocks.push_back(Point(x, y));
-    size = (int)blocks.size();
-    
-    if (blocks.size() == 1) {
-        position = blocks[0];
+    if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return;
+
+    if (rows.empty()) {
+        top = y;
+        left = right = x;
+        rows.push_back(BoardRowMask());
+        position = Point(x, y);
     }
+
+    // Grow the bounding box to include row y
+    while (y < top) {
+        rows.insert(rows.begin(), BoardRowMask());
+        top--;
+    }
+    while (y >= top + (int)rows.size()) {
+        rows.push_back(BoardRowMask());
+    }
+
+    BoardRowMask& row = rows[y - top];
+    if (!row[x]) {
+        row[x] = true;
+        size++;
+    }
+    if (x < left) left = x;
+    if (x > right) right = x;
 }
 
 void Obstacle::addBlock(const Point& p) {
@@ -33,125 +65,165 @@ bool Obstacle::containsPoint(const Point& p) const {
 }
 
 bool Obstacle::containsPoint(int x, int y) const {
-    for (const auto& block : blocks) {
-        if (block.getX() == x && block.getY() == y) {
-            return true;
-        }
+    if (y < top || y >= top + (int)rows.size()) return false;
+    if (x < left || x > right) return false;
+    return rows[y - top][x];
+}
+
+BoardRowMask Obstacle::getRow(int y) const {
+    if (y < top || y >= top + (int)rows.size()) return BoardRowMask();
+    return rows[y - top];
+}
+
+bool Obstacle::intersects(const BoardMask& mask) const {
+    for (int i = 0; i < (int)rows.size(); i++) {
+        int y = top + i;
+        if (y < 0 || y >= GameConfig::GAME_HEIGHT) continue;
+        if ((rows[i] & mask.rows[y]).any()) return true;
     }
     return false;
 }
 
+BoardRowMask Obstacle::getFrontRow(int y, Direction dir) const {
+    BoardRowMask target;
+    switch (dir) {
+    case Direction::LEFT:  target = getRow(y) >> 1; break;
+    case Direction::RIGHT: target = getRow(y) << 1; break;
+    case Direction::UP:    target = getRow(y + 1); break;
+    case Direction::DOWN:  target = getRow(y - 1); break;
+    default: return BoardRowMask();
+    }
+    return target & ~getRow(y);
+}
+
+void Obstacle::getTargetRows(Direction dir, int& firstY, int& lastY) const {
+    int dx, dy;
+    directionDelta(dir, dx, dy);
+    firstY = top + dy;
+    lastY = top + (int)rows.size() - 1 + dy;
+}
+
+bool Obstacle::canMoveWithinBoard(Direction dir) const {
+    if (rows.empty()) return false;
+    switch (dir) {
+    case Direction::LEFT:  return left > 0;
+    case Direction::RIGHT: return right < GameConfig::GAME_WIDTH - 1;
+    case Direction::UP:    return top > 0;
+    case Direction::DOWN:  return top + (int)rows.size() < GameConfig::GAME_HEIGHT;
+    default: return false;
+    }
+}
+
 // AI-assisted: Check if obstacle can be pushed with given force
-// Requires combined force >= obstacle size, and clear destination cells
+// Requires combined force >= obstacle size, and every newly covered cell empty
+// (one shift-and-AND per row against the board's occupied bit plane)
 bool Obstacle::canPush(Direction dir, GameBoard* board, int force) const {
     if (!board || force < size) return false;
-    
-    int dx = 0, dy = 0;
-    if (dir == Direction::UP) dy = -1;
-    else if (dir == Direction::DOWN) dy = 1;
-    else if (dir == Direction::LEFT) dx = -1;
-    else if (dir == Direction::RIGHT) dx = 1;
-    else return false;
-    
-    // Check each block can move to its new position
-    for (const auto& block : blocks) {
-        int newX = block.getX() + dx;
-        int newY = block.getY() + dy;
-        
-        char cell = board->getCell(newX, newY);
-        
-        if (cell == 'W') return false;  // walls block
-        if (containsPoint(newX, newY)) continue;  // own block is fine
-        
-        if (cell != ' ' && cell != GameConfig::CHAR_EMPTY) {
-            return false;
-        }
+    if (!canMoveWithinBoard(dir)) return false;
+
+    int firstY, lastY;
+    getTargetRows(dir, firstY, lastY);
+    for (int y = firstY; y <= lastY; y++) {
+        if ((getFrontRow(y, dir) & board->getOccupiedRow(y)).any()) return false;
     }
     
     return true;
 }
 
+void Obstacle::shift(Direction dir) {
+    int dx, dy;
+    directionDelta(dir, dx, dy);
+
+    if (dx > 0) {
+        for (auto& row : rows) row <<= 1;
+    } else if (dx < 0) {
+        for (auto& row : rows) row >>= 1;
+    }
+    top += dy;
+    left += dx;
+    right += dx;
+    position = Point(position.getX() + dx, position.getY() + dy);
+}
+
 // Move all blocks one cell in direction
 bool Obstacle::push(Direction dir, GameBoard* board, int force) {
     if (!canPush(dir, board, force)) return false;
     
-    int dx = 0, dy = 0;
-    if (dir == Direction::UP) dy = -1;
-    else if (dir == Direction::DOWN) dy = 1;
-    else if (dir == Direction::LEFT) dx = -1;
-    else if (dir == Direction::RIGHT) dx = 1;
-    else return false;
-    
     clearFromBoard(board);
-    
-    for (auto& block : blocks) {
-        block.setX(block.getX() + dx);
-        block.setY(block.getY() + dy);
-    }
-    
-    if (!blocks.empty()) {
-        position = blocks[0];
-    }
-    
+    shift(dir);
     updateBoard(board);
     
     return true;
 }
 
+// Clear every obstacle first so blocks moving into each other's cells are not erased
+void Obstacle::pushChain(const std::vector<Obstacle*>& chain, Direction dir, GameBoard* board) {
+    for (Obstacle* obstacle : chain) obstacle->clearFromBoard(board);
+    for (Obstacle* obstacle : chain) obstacle->shift(dir);
+    for (Obstacle* obstacle : chain) obstacle->updateBoard(board);
+}
+
 void Obstacle::updateBoard(GameBoard* board) const {
     if (!board) return;
     
-    for (const auto& block : blocks) {
-        board->setCell(block.getX(), block.getY(), '*');
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (int x = left; x <= right; x++) {
+            if (rows[i][x]) board->setCell(x, top + (int)i, '*');
+        }
     }
 }
 
 void Obstacle::clearFromBoard(GameBoard* board) const {
     if (!board) return;
     
-    for (const auto& block : blocks) {
-        board->setCell(block.getX(), block.getY(), ' ');
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (int x = left; x <= right; x++) {
+            if (rows[i][x]) board->setCell(x, top + (int)i, ' ');
+        }
     }
 }
 
 void Obstacle::draw() const {
     ::setColor(Color::Gray);
-    for (const auto& block : blocks) {
-        gotoxy(block.getX(), block.getY());
-        std::cout << '*';
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (int x = left; x <= right; x++) {
+            if (rows[i][x]) {
+                gotoxy(x, top + (int)i);
+                std::cout << '*';
+            }
+        }
     }
     resetColor();
 }
 
 void Obstacle::getBounds(int& minX, int& minY, int& maxX, int& maxY) const {
-    if (blocks.empty()) {
+    if (rows.empty()) {
         minX = minY = maxX = maxY = 0;
         return;
     }
     
-    minX = maxX = blocks[0].getX();
-    minY = maxY = blocks[0].getY();
-    
-    for (const auto& block : blocks) {
-        if (block.getX() < minX) minX = block.getX();
-        if (block.getX() > maxX) maxX = block.getX();
-        if (block.getY() < minY) minY = block.getY();
-        if (block.getY() > maxY) maxY = block.getY();
-    }
+    minX = left;
+    maxX = right;
+    minY = top;
+    maxY = top + (int)rows.size() - 1;
 }
 
 // Save starting positions for level reset
 void Obstacle::saveOriginalPositions() {
-    originalBlocks = blocks;
+    originalTop = top;
+    originalLeft = left;
+    originalRight = right;
+    originalRows = rows;
+    originalPosition = position;
 }
 
 void Obstacle::reset() {
-    if (!originalBlocks.empty()) {
-        blocks = originalBlocks;
-        if (!blocks.empty()) {
-            position = blocks[0];
-        }
-        size = (int)blocks.size();
+    if (!originalRows.empty()) {
+        top = originalTop;
+        left = originalLeft;
+        right = originalRight;
+        rows = originalRows;
+        position = originalPosition;
         active = true;
     }
 }
@@ -3,17 +3,26 @@
 #pragma once
 
 #include "GameObject.h"
+#include "GameBoard.h"
 #include "Point.h"
 #include "Direction.h"
 #include <vector>
 
-class GameBoard;
-
 class Obstacle : public GameObject {
 private:
-    std::vector<Point> blocks;          // Current positions of all blocks
-    std::vector<Point> originalBlocks;  // Original positions (for reset)
+    // Shape: one bit row per board row of the bounding box (bit x = block at column x)
+    int top;                            // Board row of rows[0]
+    int left, right;                    // Bounding box columns (inclusive)
+    std::vector<BoardRowMask> rows;
     int size;                           // Number of blocks = force required to push
+
+    // Original shape (for reset)
+    int originalTop, originalLeft, originalRight;
+    std::vector<BoardRowMask> originalRows;
+    Point originalPosition;
+
+    // Move the shape without touching the board
+    void shift(Direction dir);
     
 public:
     Obstacle();
@@ -23,21 +32,32 @@ public:
     void addBlock(int x, int y);
     void addBlock(const Point& p);
     
-    // Get all blocks
-    const std::vector<Point>& getBlocks() const { return blocks; }
-    
     // Get size (force required to push)
     int getSize() const { return size; }
     
-    // Check if a point is part of this obstacle
+    // Check if a point is part of this obstacle (O(1))
     bool containsPoint(const Point& p) const;
     bool containsPoint(int x, int y) const;
-    
-    // Check if obstacle can be pushed in direction
+
+    // Shape rows in board coordinates
+    BoardRowMask getRow(int y) const;
+    // True if any block lies on a cell of the mask
+    bool intersects(const BoardMask& mask) const;
+    // Cells of row y the shape would newly cover after moving one cell in dir
+    BoardRowMask getFrontRow(int y, Direction dir) const;
+    // Board rows touched by the shape after moving in dir
+    void getTargetRows(Direction dir, int& firstY, int& lastY) const;
+    // False if moving in dir would leave the board
+    bool canMoveWithinBoard(Direction dir) const;
+    
+    // Check if obstacle alone can be pushed in direction
     bool canPush(Direction dir, GameBoard* board, int force) const;
     
     // Push the obstacle in direction (returns true if successful)
     bool push(Direction dir, GameBoard* board, int force);
+
+    // Push several obstacles together (caller has checked the chain is free)
+    static void pushChain(const std::vector<Obstacle*>& chain, Direction dir, GameBoard* board);
     
     // Update board with obstacle positions
     void updateBoard(GameBoard* board) const;
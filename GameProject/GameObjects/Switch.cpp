@@ -1,20 +1,20 @@
-// Switch.cpp - Toggle switch linked to a specific gate
+// Switch.cpp - Toggle switch wired to one or more gates
 
 #include "Switch.h"
 #include "Player.h"
 #include <iostream>
 
 // Constructors
-Switch::Switch() : GameObject(0, 0, '\\', Color::Gray), isOn(false), linkedGate('\0') {}
+Switch::Switch() : GameObject(0, 0, '\\', Color::Gray), isOn(false), signalInput(-1) {}
 
-Switch::Switch(int x, int y, char gateNum, bool startOn)
+Switch::Switch(int x, int y, const std::string& gateNums, bool startOn)
     : GameObject(x, y, startOn ? '/' : '\\', startOn ? Color::LightGreen : Color::Gray),
-    isOn(startOn), linkedGate(gateNum) {
+    isOn(startOn), linkedGates(gateNums), signalInput(-1) {
 }
 
-Switch::Switch(const Point& pos, char gateNum, bool startOn)
+Switch::Switch(const Point& pos, const std::string& gateNums, bool startOn)
     : GameObject(pos, startOn ? '/' : '\\', startOn ? Color::LightGreen : Color::Gray),
-    isOn(startOn), linkedGate(gateNum) {
+    isOn(startOn), linkedGates(gateNums), signalInput(-1) {
 }
 
 // State
@@ -39,8 +39,13 @@ void Switch::reset() {
     active = true;
 }
 
-// Gate link
-char Switch::getLinkedGate() const { return linkedGate; }
+// Gate links
+char Switch::getLinkedGate() const { return linkedGates.empty() ? '\0' : linkedGates[0]; }
+const std::string& Switch::getLinkedGates() const { return linkedGates; }
+
+// Signal graph
+int Switch::getSignalInput() const { return signalInput; }
+void Switch::setSignalInput(int id) { signalInput = id; }
 
 // Interaction
 bool Switch::onInteract(Player& player) {
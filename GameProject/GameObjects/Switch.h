@@ -4,18 +4,20 @@
 
 #include "GameObject.h"
 #include "GameConfig.h"
+#include <string>
 
 class Player;
 
 class Switch : public GameObject {
 private:
     bool isOn;
-    char linkedGate;  // Which gate this switch is linked to (by door number)
+    std::string linkedGates;  // Gates this switch is wired to (by door number)
+    int signalInput;          // Input id in the level's signal graph (-1 = not wired)
 
 public:
     Switch();
-    Switch(int x, int y, char gateNum, bool startOn = false);
-    Switch(const Point& pos, char gateNum, bool startOn = false);
+    Switch(int x, int y, const std::string& gateNums, bool startOn = false);
+    Switch(const Point& pos, const std::string& gateNums, bool startOn = false);
 
     // State
     bool getIsOn() const;
@@ -24,8 +26,13 @@ public:
     void turnOff();
     void reset();
 
-    // Gate link
-    char getLinkedGate() const;
+    // Gate links
+    char getLinkedGate() const;  // First linked gate
+    const std::string& getLinkedGates() const;
+
+    // Signal graph
+    int getSignalInput() const;
+    void setSignalInput(int id);
 
     // Interaction
     bool onInteract(Player& player) override;
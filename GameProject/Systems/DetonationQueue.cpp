@@ -0,0 +1,49 @@
+// DetonationQueue.cpp - (cycle, bomb) event queue for bomb explosions
+
+#include "DetonationQueue.h"
+#include "GameConfig.h"
+#include <algorithm>
+
+DetonationQueue::DetonationQueue()
+    : reachedCycle(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, -1), cycle(0) {
+}
+
+void DetonationQueue::clear() {
+    pending = decltype(pending)();
+    scheduledCycle.clear();
+    std::fill(reachedCycle.begin(), reachedCycle.end(), -1);
+    cycle = 0;
+}
+
+int DetonationQueue::beginCycle() {
+    return ++cycle;
+}
+
+void DetonationQueue::schedule(int bomb, int atCycle) {
+    if (bomb < 0) return;
+    if (bomb >= (int)scheduledCycle.size()) scheduledCycle.resize(bomb + 1, -1);
+    if (scheduledCycle[bomb] == atCycle) return;
+    scheduledCycle[bomb] = atCycle;
+    pending.push(Detonation(atCycle, bomb));
+}
+
+bool DetonationQueue::popDue(int& bomb) {
+    while (!pending.empty() && pending.top().cycle <= cycle) {
+        Detonation next = pending.top();
+        pending.pop();
+        // Skip entries superseded by a later schedule of the same bomb
+        if (scheduledCycle[next.bomb] != next.cycle) continue;
+        scheduledCycle[next.bomb] = -1;
+        bomb = next.bomb;
+        return true;
+    }
+    return false;
+}
+
+bool DetonationQueue::isCellReached(int cell) const {
+    return reachedCycle[cell] == cycle;
+}
+
+void DetonationQueue::markCellReached(int cell) {
+    reachedCycle[cell] = cycle;
+}
@@ -0,0 +1,46 @@
+// DetonationQueue.h - Bomb detonations ordered by (cycle, bomb index)
+// A min-heap of pending detonations plus per-cell "already reached" stamps, so a chain
+// reaction touches only the bombs it reaches instead of rescanning every bomb per blast.
+
+#pragma once
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+class DetonationQueue {
+private:
+    struct Detonation {
+        int cycle;
+        int bomb;
+
+        Detonation(int c, int b) : cycle(c), bomb(b) {}
+        bool operator>(const Detonation& other) const {
+            return cycle != other.cycle ? cycle > other.cycle : bomb > other.bomb;
+        }
+    };
+
+    std::priority_queue<Detonation, std::vector<Detonation>, std::greater<Detonation>> pending;
+    std::vector<int> scheduledCycle;  // Bomb index -> cycle it is queued for (-1 = none)
+    std::vector<int> reachedCycle;    // Cell -> last cycle a blast accelerated bombs there
+    int cycle;
+
+public:
+    DetonationQueue();
+
+    void clear();
+
+    // Advance to the next cycle and return its number
+    int beginCycle();
+    int getCycle() const { return cycle; }
+
+    // Queue a bomb (a bomb already queued for that cycle is not added twice)
+    void schedule(int bomb, int atCycle);
+
+    // Next bomb due by the current cycle, lowest (cycle, index) first
+    bool popDue(int& bomb);
+
+    // Cells a blast already handled this cycle (later blasts leave their bombs alone)
+    bool isCellReached(int cell) const;
+    void markCellReached(int cell);
+};
@@ -0,0 +1,109 @@
+// ExplosionShield.cpp - Integer ray tables and the one-pass blast mask
+// A ray from the bomb to (dx, dy) visits step i = 1..n-1 (n = max(|dx|, |dy|)) at
+// offset (2*dx*i + n) / (2*n): add one half, then truncate toward zero, the same as
+// the old float-stepped raycast's (int)(step * i + 0.5f). The cells it checked are now
+// fixed per offset instead of walked per blast.
+
+#include "ExplosionShield.h"
+#include "GameConfig.h"
+#include <algorithm>
+
+namespace {
+
+const int R = ExplosionShield::MAX_RADIUS;
+const int SPAN = 2 * R + 1;
+
+struct RayCell {
+    signed char dx;
+    signed char dy;
+};
+
+struct Ray {
+    int length;               // Cells between bomb and target
+    RayCell cells[R > 1 ? R - 1 : 1];
+};
+
+struct RayTable {
+    Ray rays[SPAN][SPAN];     // [dy + R][dx + R]
+};
+
+constexpr int absInt(int v) { return v < 0 ? -v : v; }
+
+// (2 * num + n) / (2 * n) truncates toward zero exactly like (int)(num / n + 0.5f)
+constexpr int rayOffset(int d, int i, int steps) {
+    return (2 * d * i + steps) / (2 * steps);
+}
+
+constexpr RayTable buildRayTable() {
+    RayTable table{};
+    for (int dy = -R; dy <= R; dy++) {
+        for (int dx = -R; dx <= R; dx++) {
+            Ray& ray = table.rays[dy + R][dx + R];
+            int steps = std::max(absInt(dx), absInt(dy));
+            ray.length = 0;
+            for (int i = 1; i < steps; i++) {
+                ray.cells[ray.length].dx = static_cast<signed char>(rayOffset(dx, i, steps));
+                ray.cells[ray.length].dy = static_cast<signed char>(rayOffset(dy, i, steps));
+                ray.length++;
+            }
+        }
+    }
+    return table;
+}
+
+constexpr RayTable RAYS = buildRayTable();
+
+// Ray cells off the board count as walls, matching GameBoard::getCell
+bool isWallCell(const BoardRowMask& row, int x) {
+    return x < 0 || x >= GameConfig::GAME_WIDTH || row[x];
+}
+
+bool rayBlocked(const Ray& ray, const BoardRowMask* const* wallRows, int originX) {
+    for (int k = 0; k < ray.length; k++) {
+        if (isWallCell(*wallRows[ray.cells[k].dy + R], originX + ray.cells[k].dx)) return true;
+    }
+    return false;
+}
+
+}
+
+BoardMask ExplosionShield::compute(const GameBoard* board, const Point& origin, int radius) {
+    BoardMask mask;
+    int r = std::min(radius, R);
+    int ox = origin.getX();
+    int oy = origin.getY();
+    if (r <= 0) return mask;
+
+    // Wall rows the blast spans, looked up once (rows are indexed by dy + R)
+    static const BoardRowMask noWalls;
+    const BoardRowMask* wallRows[SPAN];
+    for (int dy = -R; dy <= R; dy++) {
+        wallRows[dy + R] = (board && dy >= -r && dy <= r) ? &board->getWallRow(oy + dy) : &noWalls;
+    }
+
+    int minX = std::max(ox - r, 1);
+    int maxX = std::min(ox + r, GameConfig::GAME_WIDTH - 2);
+    for (int dy = -r; dy <= r; dy++) {
+        int ty = oy + dy;
+        if (ty < 1 || ty >= GameConfig::GAME_HEIGHT - 1) continue;
+
+        BoardRowMask& row = mask.rows[ty];
+        for (int tx = minX; tx <= maxX; tx++) {
+            int dx = tx - ox;
+            if (dx == 0 && dy == 0) continue;  // Bomb's own cell
+            if (!rayBlocked(RAYS.rays[dy + R][dx + R], wallRows, ox)) row.set(tx);
+        }
+    }
+    return mask;
+}
+
+bool ExplosionShield::isShielded(const GameBoard* board, const Point& origin, const Point& target) {
+    if (!board) return false;
+    int dx = target.getX() - origin.getX();
+    int dy = target.getY() - origin.getY();
+    if (absInt(dx) > R || absInt(dy) > R) return false;
+
+    const BoardRowMask* wallRows[SPAN];
+    for (int i = 0; i < SPAN; i++) wallRows[i] = &board->getWallRow(origin.getY() + i - R);
+    return rayBlocked(RAYS.rays[dy + R][dx + R], wallRows, origin.getX());
+}
@@ -0,0 +1,19 @@
+// ExplosionShield.h - Wall-shielded blast areas from precomputed integer rays
+// Every offset in the blast square has a fixed ray path (built at compile time), so a
+// blast costs one lookup of the wall rows it spans plus at most r-1 bit tests per cell.
+
+#pragma once
+
+#include "GameBoard.h"
+#include "Point.h"
+
+class ExplosionShield {
+public:
+    static const int MAX_RADIUS = 4;
+
+    // Cells one blast reaches; radii above MAX_RADIUS are capped
+    static BoardMask compute(const GameBoard* board, const Point& origin, int radius);
+
+    // True if a wall lies on the ray between origin and target (target within MAX_RADIUS)
+    static bool isShielded(const GameBoard* board, const Point& origin, const Point& target);
+};
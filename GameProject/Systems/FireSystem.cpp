@@ -0,0 +1,120 @@
+// FireSystem.cpp - Bit-plane cellular automaton for spreading fire
+// Rules per cycle, per row (b = burning, a1 a0 = age, f = brush):
+//   spread = b<<1 | b>>1 | b(row above) | b(row below)
+//   ignite = spread & f                      (walls are never brush, so fire stops there)
+//   age'   = age + 1 on burning cells        (bit-sliced half adder)
+//   out    = b & age' == BURN_CYCLES         (burnt out, tile becomes empty)
+//   b'     = (b & ~out) | ignite             (new fires start at age 0)
+// The next generation is written to the other buffer, then the buffers swap.
+
+#include "FireSystem.h"
+
+FireSystem::FireSystem() : current(0), burningAny(false), board(nullptr) {
+}
+
+void FireSystem::setBoard(GameBoard* b) {
+    board = b;
+}
+
+void FireSystem::addBrush(int x, int y) {
+    brush.set(Point(x, y));
+    if (board) board->setCell(x, y, GameConfig::CHAR_BRUSH);
+}
+
+// Put out every fire and grow the screen's brush back
+void FireSystem::reset() {
+    states[0] = FireState();
+    states[1] = FireState();
+    current = 0;
+    burningAny = false;
+    if (!board) return;
+    for (const Point& p : brush.toPoints()) {
+        char c = board->getCell(p);
+        if (c == GameConfig::CHAR_EMPTY || c == GameConfig::CHAR_FIRE) {
+            board->setCell(p, GameConfig::CHAR_BRUSH);
+        }
+    }
+}
+
+BoardMask FireSystem::ignite(const BoardMask& area) {
+    BoardMask lit;
+    if (!board) return lit;
+
+    FireState& s = states[current];
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        lit.rows[y] = area.rows[y] & board->getBrushRow(y);
+        if (lit.rows[y].none()) continue;
+
+        s.burning[y] |= lit.rows[y];
+        s.age0[y] &= ~lit.rows[y];
+        s.age1[y] &= ~lit.rows[y];
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            if (lit.rows[y][x]) board->setCell(x, y, GameConfig::CHAR_FIRE);
+        }
+        burningAny = true;
+    }
+    return lit;
+}
+
+bool FireSystem::ignite(const Point& p) {
+    BoardMask cell;
+    cell.set(p);
+    return !ignite(cell).none();
+}
+
+bool FireSystem::update(BoardMask& changed) {
+    changed = BoardMask();
+    if (!burningAny || !board) return false;
+
+    const FireState& cur = states[current];
+    FireState& next = states[1 - current];
+    const int H = GameConfig::GAME_HEIGHT;
+
+    // Fires whose tile was cleared or covered since the last cycle are gone
+    BoardRowMask burning[GameConfig::GAME_HEIGHT];
+    for (int y = 0; y < H; y++) {
+        burning[y] = cur.burning[y] & board->getFireRow(y);
+    }
+
+    bool any = false;
+    for (int y = 0; y < H; y++) {
+        const BoardRowMask& b = burning[y];
+        BoardRowMask spread = (b << 1) | (b >> 1);
+        if (y > 0) spread |= burning[y - 1];
+        if (y < H - 1) spread |= burning[y + 1];
+        BoardRowMask lit = spread & board->getBrushRow(y);
+
+        // Half adder on the age planes of burning cells
+        BoardRowMask a0 = cur.age0[y] ^ b;
+        BoardRowMask a1 = cur.age1[y] ^ (cur.age0[y] & b);
+        BoardRowMask out = b & ((BURN_CYCLES & 1) ? a0 : ~a0) & ((BURN_CYCLES & 2) ? a1 : ~a1);
+
+        BoardRowMask keep = b & ~out;
+        next.burning[y] = keep | lit;
+        next.age0[y] = a0 & keep;
+        next.age1[y] = a1 & keep;
+
+        changed.rows[y] = lit | out;
+        if (next.burning[y].any()) any = true;
+    }
+
+    current = 1 - current;
+    burningAny = any;
+
+    // Write the changed tiles back to the board
+    for (int y = 0; y < H; y++) {
+        if (changed.rows[y].none()) continue;
+        const BoardRowMask& lit = states[current].burning[y];
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            if (!changed.rows[y][x]) continue;
+            board->setCell(x, y, lit[x] ? GameConfig::CHAR_FIRE : GameConfig::CHAR_EMPTY);
+        }
+    }
+    return !changed.none();
+}
+
+// The board has the last word: a fire tile cleared by shrapnel no longer burns
+bool FireSystem::isBurning(const Point& p) const {
+    if (!p.isInBounds() || !states[current].burning[p.getY()][p.getX()]) return false;
+    return !board || board->getCell(p) == GameConfig::CHAR_FIRE;
+}
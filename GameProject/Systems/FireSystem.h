@@ -0,0 +1,47 @@
+// FireSystem.h - Spreading fire on brush tiles
+// A double-buffered cellular automaton over board bit planes: each cycle the burning
+// plane spreads to 4-neighbouring brush and ages by one, with the age kept as two bit
+// planes, so a whole row is updated with a handful of word-wide bitset operations.
+
+#pragma once
+
+#include "GameBoard.h"
+
+class FireSystem {
+public:
+    static const int BURN_CYCLES = 3;  // Cycles a tile burns before it is gone
+    static_assert(BURN_CYCLES >= 1 && BURN_CYCLES <= 3, "burn age is two bit planes");
+
+private:
+    struct FireState {
+        BoardRowMask burning[GameConfig::GAME_HEIGHT];
+        BoardRowMask age0[GameConfig::GAME_HEIGHT];  // Low bit of cycles burnt so far
+        BoardRowMask age1[GameConfig::GAME_HEIGHT];  // High bit
+    };
+
+    FireState states[2];    // Current and next generation
+    int current;
+    BoardMask brush;        // Brush declared by the screen (restored on reset)
+    bool burningAny;
+
+    GameBoard* board;
+
+public:
+    FireSystem();
+
+    void setBoard(GameBoard* b);
+
+    // Setup (screen parser)
+    void addBrush(int x, int y);
+    void reset();
+
+    // Set brush in area alight now; returns the cells that caught fire
+    BoardMask ignite(const BoardMask& area);
+    bool ignite(const Point& p);
+
+    // Advance one cycle; changed receives cells whose board character changed
+    bool update(BoardMask& changed);
+
+    bool isBurning(const Point& p) const;
+    bool hasFire() const { return burningAny; }
+};
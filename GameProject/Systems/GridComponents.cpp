@@ -0,0 +1,74 @@
+// GridComponents.cpp - Union-find labelling of connected board cells
+// Path halving plus union by size keeps every find effectively constant time
+
+#include "GridComponents.h"
+#include "GameConfig.h"
+#include <algorithm>
+#include <utility>
+
+GridComponents::GridComponents()
+    : parent(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, -1),
+    size(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, 0) {
+}
+
+int GridComponents::cellIndex(int x, int y) {
+    return y * GameConfig::GAME_WIDTH + x;
+}
+
+int GridComponents::find(int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+void GridComponents::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (size[a] < size[b]) std::swap(a, b);
+    parent[b] = a;
+    size[a] += size[b];
+}
+
+std::vector<std::vector<Point>> GridComponents::group(const std::vector<Point>& cells) {
+    std::fill(parent.begin(), parent.end(), -1);
+    std::fill(size.begin(), size.end(), 0);
+
+    for (const auto& p : cells) {
+        if (!p.isInBounds()) continue;
+        int idx = cellIndex(p.getX(), p.getY());
+        parent[idx] = idx;
+        size[idx] = 1;
+    }
+
+    // Single row-major sweep: link each cell to its left and upper neighbour
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            int idx = cellIndex(x, y);
+            if (parent[idx] < 0) continue;
+            if (x > 0 && parent[idx - 1] >= 0) unite(idx, idx - 1);
+            if (y > 0 && parent[idx - GameConfig::GAME_WIDTH] >= 0) {
+                unite(idx, idx - GameConfig::GAME_WIDTH);
+            }
+        }
+    }
+
+    // Second sweep hands out component numbers in order of first appearance
+    std::vector<std::vector<Point>> components;
+    std::vector<int> componentOf(parent.size(), -1);
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            int idx = cellIndex(x, y);
+            if (parent[idx] < 0) continue;
+            int root = find(idx);
+            if (componentOf[root] < 0) {
+                componentOf[root] = (int)components.size();
+                components.emplace_back();
+            }
+            components[componentOf[root]].push_back(Point(x, y));
+        }
+    }
+    return components;
+}
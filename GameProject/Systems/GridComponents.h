@@ -0,0 +1,27 @@
+// GridComponents.h - Connected-region grouping for board cells
+// Union-find over the game grid: one pass unions each cell with its left and upper
+// neighbour, so grouping n cells costs O(n + board size) instead of all-pairs checks
+
+#pragma once
+
+#include "Point.h"
+#include <vector>
+
+class GridComponents {
+private:
+    std::vector<int> parent;  // Cell index -> parent cell index (-1 = not in the set)
+    std::vector<int> size;    // Component size, valid at roots
+
+    static int cellIndex(int x, int y);
+
+    int find(int i);
+    void unite(int a, int b);
+
+public:
+    GridComponents();
+
+    // Group orthogonally adjacent cells (out-of-board cells are ignored).
+    // Components come out ordered by their first cell in row-major order,
+    // and the cells of each component are listed in row-major order too.
+    std::vector<std::vector<Point>> group(const std::vector<Point>& cells);
+};
@@ -7,7 +7,7 @@
 
 // Constructor
 InputHandler::InputHandler() 
-    : player1(nullptr), player2(nullptr), isPaused(false), recorder(nullptr) {}
+    : player1(nullptr), player2(nullptr), isPaused(false), riddlePlayer(0), recorder(nullptr), keyboard(nullptr), latency(nullptr) {}
 
 // Setup players
 void InputHandler::setPlayers(Player* p1, Player* p2) {
@@ -20,6 +20,15 @@ void InputHandler::setRecorder(GameRecorder* rec) {
     recorder = rec;
 }
 
+// Setup keyboard thread (keys then come from its ring instead of the console)
+void InputHandler::setKeyboard(KeyboardThread* kb) {
+    keyboard = kb;
+}
+
+void InputHandler::setLatencyTracker(LatencyTracker* tracker) {
+    latency = tracker;
+}
+
 // Pause state
 void InputHandler::setPaused(bool paused) {
     isPaused = paused;
@@ -29,8 +38,14 @@ bool InputHandler::getIsPaused() const {
     return isPaused;
 }
 
-// Handle a single key press
-void InputHandler::handleKey(char key, InputResult& result) {
+// Riddle state (set by the level before each input pass)
+void InputHandler::setRiddlePlayer(int playerNum) {
+    riddlePlayer = playerNum;
+}
+
+// Handle a single key press: fold it into the frame and return the player it
+// belongs to (0 for pause/menu keys and unknown keys)
+int InputHandler::handleKey(char key, InputResult& result) {
     key = std::toupper(key);
     
     // ESC key - but ignore in load mode
@@ -38,7 +53,7 @@ void InputHandler::handleKey(char key, InputResult& result) {
         if (!recorder || !recorder->isLoadMode()) {
             result.escPressed = true;
         }
-        return;
+        return 0;
     }
     
     // When paused, check for menu or save
@@ -48,84 +63,71 @@ void InputHandler::handleKey(char key, InputResult& result) {
         } else if (key == 'S') {
             result.saveRequested = true;
         }
-        return;
+        return 0;
     }
     
-    // Track direction changes for recording
-    Direction p1OldDir = player1 ? player1->getDirection() : Direction::STAY;
-    Direction p2OldDir = player2 ? player2->getDirection() : Direction::STAY;
+    // While a riddle is open, only the asked player's answer keys answer it;
+    // every other key is ordinary movement
+    if (riddlePlayer != 0) {
+        const char* answerKeys = (riddlePlayer == 1) ? GameConfig::P1_ANSWER_KEYS : GameConfig::P2_ANSWER_KEYS;
+        for (int i = 0; i < 4; i++) {
+            if (key != answerKeys[i]) continue;
+            PlayerInput& asked = (riddlePlayer == 1) ? result.frame.player1 : result.frame.player2;
+            asked.setAnswer(static_cast<char>('a' + i));
+            return riddlePlayer;
+        }
+    }
     
     // Player 1 controls
     if (player1) {
         switch (key) {
-            case GameConfig::P1_UP:
-                player1->setDirection(Direction::UP);
-                if (recorder && recorder->isSaveMode() && Direction::UP != p1OldDir)
-                    recorder->recordStep(1, Direction::UP);
-                break;
-            case GameConfig::P1_DOWN:
-                player1->setDirection(Direction::DOWN);
-                if (recorder && recorder->isSaveMode() && Direction::DOWN != p1OldDir)
-                    recorder->recordStep(1, Direction::DOWN);
-                break;
-            case GameConfig::P1_LEFT:
-                player1->setDirection(Direction::LEFT);
-                if (recorder && recorder->isSaveMode() && Direction::LEFT != p1OldDir)
-                    recorder->recordStep(1, Direction::LEFT);
-                break;
-            case GameConfig::P1_RIGHT:
-                player1->setDirection(Direction::RIGHT);
-                if (recorder && recorder->isSaveMode() && Direction::RIGHT != p1OldDir)
-                    recorder->recordStep(1, Direction::RIGHT);
-                break;
-            case GameConfig::P1_STAY:
-                player1->stop();
-                if (recorder && recorder->isSaveMode())
-                    recorder->recordStop(1);
-                break;
-            case GameConfig::P1_DISPOSE:
-                result.player1Dispose = true;
-                if (recorder && recorder->isSaveMode())
-                    recorder->recordDispose(1);
-                break;
+            case GameConfig::P1_UP:      result.frame.player1.setDirection(Direction::UP); return 1;
+            case GameConfig::P1_DOWN:    result.frame.player1.setDirection(Direction::DOWN); return 1;
+            case GameConfig::P1_LEFT:    result.frame.player1.setDirection(Direction::LEFT); return 1;
+            case GameConfig::P1_RIGHT:   result.frame.player1.setDirection(Direction::RIGHT); return 1;
+            case GameConfig::P1_STAY:    result.frame.player1.setStop(); return 1;
+            case GameConfig::P1_DISPOSE: result.frame.player1.setDispose(); return 1;
         }
     }
     
     // Player 2 controls
     if (player2) {
         switch (key) {
-            case GameConfig::P2_UP:
-                player2->setDirection(Direction::UP);
-                if (recorder && recorder->isSaveMode() && Direction::UP != p2OldDir)
-                    recorder->recordStep(2, Direction::UP);
-                break;
-            case GameConfig::P2_DOWN:
-                player2->setDirection(Direction::DOWN);
-                if (recorder && recorder->isSaveMode() && Direction::DOWN != p2OldDir)
-                    recorder->recordStep(2, Direction::DOWN);
-                break;
-            case GameConfig::P2_LEFT:
-                player2->setDirection(Direction::LEFT);
-                if (recorder && recorder->isSaveMode() && Direction::LEFT != p2OldDir)
-                    recorder->recordStep(2, Direction::LEFT);
-                break;
-            case GameConfig::P2_RIGHT:
-                player2->setDirection(Direction::RIGHT);
-                if (recorder && recorder->isSaveMode() && Direction::RIGHT != p2OldDir)
-                    recorder->recordStep(2, Direction::RIGHT);
-                break;
-            case GameConfig::P2_STAY:
-                player2->stop();
-                if (recorder && recorder->isSaveMode())
-                    recorder->recordStop(2);
-                break;
-            case GameConfig::P2_DISPOSE:
-                result.player2Dispose = true;
-                if (recorder && recorder->isSaveMode())
-                    recorder->recordDispose(2);
-                break;
+            case GameConfig::P2_UP:      result.frame.player2.setDirection(Direction::UP); return 2;
+            case GameConfig::P2_DOWN:    result.frame.player2.setDirection(Direction::DOWN); return 2;
+            case GameConfig::P2_LEFT:    result.frame.player2.setDirection(Direction::LEFT); return 2;
+            case GameConfig::P2_RIGHT:   result.frame.player2.setDirection(Direction::RIGHT); return 2;
+            case GameConfig::P2_STAY:    result.frame.player2.setStop(); return 2;
+            case GameConfig::P2_DISPOSE: result.frame.player2.setDispose(); return 2;
         }
     }
+    return 0;
+}
+
+// Record one player's folded commands for this cycle in the order playback applies
+// them (direction, stop, dispose, answer); an unchanged direction is not recorded
+void InputHandler::recordPlayerInput(int playerNum, const Player* player, const PlayerInput& in) {
+    if (!recorder || !recorder->isSaveMode() || !player || in.isEmpty()) return;
+    
+    if (in.hasDirection && in.direction != player->getDirection()) {
+        recorder->recordStep(playerNum, in.direction);
+    }
+    if (in.stop) recorder->recordStop(playerNum);
+    if (in.dispose) recorder->recordDispose(playerNum);
+    if (in.answer != '\0') recorder->recordRiddleAnswer(playerNum, in.answer);
+}
+
+// Next pending key: from the keyboard thread's ring, or from the console
+// when no thread is running
+bool InputHandler::nextKey(KeyEvent& ev) {
+    if (keyboard && keyboard->isRunning()) {
+        return keyboard->poll(ev);
+    }
+    if (!_kbhit()) {
+        return false;
+    }
+    ev = KeyEvent((char)_getch(), std::chrono::steady_clock::now());
+    return true;
 }
 
 // Get recorded input for a specific player
@@ -168,7 +170,7 @@ InputResult InputHandler::processInput() {
     InputResult result;
     
     // In load mode, read from recorded steps instead of keyboard
-    // Note: Riddle answers are stored separately and handled by getRiddleAnswer()
+    // Riddle answers are ordinary steps ('1'-'4' = a-d), folded like everything else
     if (recorder && recorder->isLoadMode()) {
         // Process all movement steps for current cycle
         while (recorder->hasNextStep()) {
@@ -182,24 +184,28 @@ InputResult InputHandler::processInput() {
             // Process this step
             step = recorder->getNextStep();
             
-            // Apply the action
+            // Fold the action into this cycle's frame
             if (step.player == 1 && player1) {
                 switch (std::toupper(step.action)) {
-                    case 'U': player1->setDirection(Direction::UP); break;
-                    case 'D': player1->setDirection(Direction::DOWN); break;
-                    case 'L': player1->setDirection(Direction::LEFT); break;
-                    case 'R': player1->setDirection(Direction::RIGHT); break;
-                    case 'S': player1->stop(); break;
-                    case 'E': result.player1Dispose = true; break;
+                    case 'U': result.frame.player1.setDirection(Direction::UP); break;
+                    case 'D': result.frame.player1.setDirection(Direction::DOWN); break;
+                    case 'L': result.frame.player1.setDirection(Direction::LEFT); break;
+                    case 'R': result.frame.player1.setDirection(Direction::RIGHT); break;
+                    case 'S': result.frame.player1.setStop(); break;
+                    case 'E': result.frame.player1.setDispose(); break;
+                    case '1': case '2': case '3': case '4':
+                        result.frame.player1.setAnswer(static_cast<char>('a' + (step.action - '1'))); break;
                 }
             } else if (step.player == 2 && player2) {
                 switch (std::toupper(step.action)) {
-                    case 'U': player2->setDirection(Direction::UP); break;
-                    case 'D': player2->setDirection(Direction::DOWN); break;
-                    case 'L': player2->setDirection(Direction::LEFT); break;
-                    case 'R': player2->setDirection(Direction::RIGHT); break;
-                    case 'S': player2->stop(); break;
-                    case 'O': result.player2Dispose = true; break;
+                    case 'U': result.frame.player2.setDirection(Direction::UP); break;
+                    case 'D': result.frame.player2.setDirection(Direction::DOWN); break;
+                    case 'L': result.frame.player2.setDirection(Direction::LEFT); break;
+                    case 'R': result.frame.player2.setDirection(Direction::RIGHT); break;
+                    case 'S': result.frame.player2.setStop(); break;
+                    case 'O': result.frame.player2.setDispose(); break;
+                    case '1': case '2': case '3': case '4':
+                        result.frame.player2.setAnswer(static_cast<char>('a' + (step.action - '1'))); break;
                 }
             }
         }
@@ -207,13 +213,30 @@ InputResult InputHandler::processInput() {
         return result;
     }
     
-    // Normal mode: read from keyboard
-    if (!_kbhit()) {
-        return result;
+    // Normal mode: consume every pending key this cycle. Each player's keys fold
+    // into one PlayerInput (last direction wins, stop and dispose are kept), so both
+    // players get their presses into the same cycle no matter how many arrive.
+    KeyEvent ev;
+    std::chrono::steady_clock::time_point lastKeyTime[2];
+    while (nextKey(ev)) {
+        int playerNum = handleKey(ev.key, result);
+        if (playerNum > 0) {
+            lastKeyTime[playerNum - 1] = ev.time;
+            if (latency) latency->keyHandled(playerNum, ev.time);
+        }
+        
+        // Keys after ESC belong to the pause menu; leave them for the next cycle
+        if (result.escPressed) break;
     }
     
-    char key = (char)_getch();
-    handleKey(key, result);
+    // Record the folded commands in this same cycle, stamped with each player's last key
+    if (recorder && recorder->isSaveMode()) {
+        recorder->setInputTime(lastKeyTime[0]);
+        recordPlayerInput(1, player1, result.frame.player1);
+        recorder->setInputTime(lastKeyTime[1]);
+        recordPlayerInput(2, player2, result.frame.player2);
+        recorder->clearInputTime();
+    }
     
     return result;
 }
@@ -5,17 +5,18 @@
 #include "Player.h"
 #include "GameConfig.h"
 #include "GameRecorder.h"
+#include "LevelStep.h"
+#include "KeyboardThread.h"
+#include "LatencyTracker.h"
 
-// Input result
+// Input result (player commands are collected in frame and applied by GameLevel::step)
 struct InputResult {
     bool escPressed;
     bool menuRequested;
     bool saveRequested;
-    bool player1Dispose;
-    bool player2Dispose;
+    InputFrame frame;
     
-    InputResult() : escPressed(false), menuRequested(false), saveRequested(false),
-                   player1Dispose(false), player2Dispose(false) {}
+    InputResult() : escPressed(false), menuRequested(false), saveRequested(false) {}
 };
 
 class InputHandler {
@@ -23,7 +24,10 @@ private:
     Player* player1;
     Player* player2;
     bool isPaused;
+    int riddlePlayer;  // Player being asked a riddle (0 = none): their answer keys answer it
     GameRecorder* recorder;
+    KeyboardThread* keyboard;
+    LatencyTracker* latency;
 
 public:
     InputHandler();
@@ -31,17 +35,24 @@ public:
     // Setup
     void setPlayers(Player* p1, Player* p2);
     void setRecorder(GameRecorder* rec);
+    void setKeyboard(KeyboardThread* kb);
+    void setLatencyTracker(LatencyTracker* tracker);
 
     // Pause
     void setPaused(bool paused);
     bool getIsPaused() const;
 
+    // Riddle
+    void setRiddlePlayer(int playerNum);
+
     // Process input
     InputResult processInput();
     
 private:
-    // Handle a single key press
-    void handleKey(char key, InputResult& result);
+    // Handle a single key press (returns the player it belongs to, or 0)
+    int handleKey(char key, InputResult& result);
+    bool nextKey(KeyEvent& ev);
+    void recordPlayerInput(int playerNum, const Player* player, const PlayerInput& in);
     
     // Get next step from recorder for load mode
     char getRecordedInput(int player);
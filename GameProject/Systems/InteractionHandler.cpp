@@ -12,23 +12,20 @@
 #include <fstream>
 
 InteractionHandler::InteractionHandler()
-    : objects(nullptr), board(nullptr), lighting(nullptr),
-    statusBar(nullptr), messageDisplay(nullptr), game(nullptr),
-    recorder(nullptr), lastTriggeredRiddle(nullptr), lastRiddlePos(-1, -1),
-    lastRiddleAnswer('\0') {
+    : objects(nullptr), board(nullptr), lighting(nullptr), fire(nullptr), game(nullptr),
+    recorder(nullptr), lastTriggeredRiddle(nullptr), lastRiddlePos(-1, -1) {
 }
 
 // Dependency injection
 void InteractionHandler::setObjectManager(ObjectManager* obj) { objects = obj; }
 void InteractionHandler::setBoard(GameBoard* b) { board = b; }
 void InteractionHandler::setLightingSystem(LightingSystem* light) { lighting = light; }
-void InteractionHandler::setStatusBar(StatusBar* status) { statusBar = status; }
-void InteractionHandler::setMessageDisplay(MessageDisplay* msg) { messageDisplay = msg; }
+void InteractionHandler::setFireSystem(FireSystem* f) { fire = f; }
 void InteractionHandler::setGame(Game* g) { game = g; }
 void InteractionHandler::setRecorder(GameRecorder* rec) { recorder = rec; }
 
 // Process all possible interactions at player position
-InteractionResult InteractionHandler::handleInteractions(Player& player) {
+InteractionResult InteractionHandler::handleInteractions(Player& player, int playerNum, StepEvents& events) {
     InteractionResult result;
     if (!objects || !board) return result;
 
@@ -37,47 +34,44 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
     // Light switch toggles room lighting
     LightSwitch* lightSw = objects->getLightSwitchAt(pos);
     if (lightSw && lightSw->isActive()) {
-        lightSw->toggle();
+        objects->toggleLightSwitch(*lightSw);
         board->setCell(pos, lightSw->getSymbol());
         result.needsFullRedraw = true;
-        if (messageDisplay) {
-            messageDisplay->show(lightSw->getIsOn() ? "Light ON!" : "Light OFF!");
-        }
+        events.push(StepEvent(StepEventType::LightToggled, playerNum, pos, lightSw->getIsOn() ? 1 : 0));
         return result;
     }
 
-    // Gate-linked switch may open/close gate
+    // Gate-linked switch may open/close the gates it is wired to
     Switch* sw = objects->getSwitchAt(pos);
     if (sw && sw->isActive()) {
-        sw->toggle();
+        objects->toggleSwitch(*sw);
         board->setCell(pos, sw->getSymbol());
         result.needsFullRedraw = true;
 
-        char linkedGate = sw->getLinkedGate();
-
-        if (objects->areAllSwitchesOnForGate(linkedGate)) {
-            Gate* gate = objects->getGateByDoorNum(linkedGate);
-            if (gate && !gate->getIsOpen()) {
-                openGate(*gate);
-                if (messageDisplay) {
-                    messageDisplay->show("All switches ON - Gate opened!");
+        // Every gate guarding a linked door follows that door's signal
+        bool anyUnlocked = false;
+        bool opened = false;
+        bool closed = false;
+        for (char linkedGate : sw->getLinkedGates()) {
+            bool unlocked = objects->isGateSignalOn(linkedGate);
+            anyUnlocked = anyUnlocked || unlocked;
+            for (Gate* gate : objects->getGatesByDoorNum(linkedGate)) {
+                if (unlocked && !gate->getIsOpen()) {
+                    openGate(*gate);
+                    opened = true;
                 }
-            }
-        }
-        else {
-            Gate* gate = objects->getGateByDoorNum(linkedGate);
-            if (gate && gate->getIsOpen()) {
-                closeGate(*gate);
-                if (messageDisplay) {
-                    messageDisplay->show("Switch OFF - Gate locked!");
-                }
-            }
-            else {
-                if (messageDisplay) {
-                    messageDisplay->show(sw->getIsOn() ? "Switch ON!" : "Switch OFF!");
+                else if (!unlocked && gate->getIsOpen()) {
+                    closeGate(*gate);
+                    closed = true;
                 }
             }
         }
+
+        if (opened) events.push(StepEvent(StepEventType::GateUnlocked, playerNum, pos));
+        if (closed) events.push(StepEvent(StepEventType::GateLocked, playerNum, pos));
+        if (!opened && !closed && !anyUnlocked) {
+            events.push(StepEvent(StepEventType::SwitchToggled, playerNum, pos, sw->getIsOn() ? 1 : 0));
+        }
         return result;
     }
 
@@ -87,13 +81,8 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
         key->onInteract(player);
         board->setCell(pos, GameConfig::CHAR_EMPTY);
         result.needsRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a KEY!");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, GameConfig::CHAR_KEY));
         return result;
     }
 
@@ -103,13 +92,8 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
         coin->onInteract(player);
         board->setCell(pos, GameConfig::CHAR_EMPTY);
         result.needsRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a COIN!");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, GameConfig::CHAR_COIN));
         return result;
     }
 
@@ -120,13 +104,8 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
         player.pickupItem(GameConfig::CHAR_KEY);
         board->setCell(pos, GameConfig::CHAR_EMPTY);
         result.needsRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a KEY!");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, GameConfig::CHAR_KEY));
         return result;
     }
 
@@ -135,14 +114,9 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
     if (torch && torch->isActive() && !player.hasItem()) {
         torch->onInteract(player);
         board->setCell(pos, GameConfig::CHAR_EMPTY);
-        result.needsFullRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a TORCH!");
-        }
+        result.needsRedraw = true;  // light change is redrawn as a visibility delta
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, GameConfig::CHAR_TORCH));
         return result;
     }
 
@@ -152,31 +126,21 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
         droppedTorch->collected = true;
         player.pickupItem(GameConfig::CHAR_TORCH);
         board->setCell(pos, GameConfig::CHAR_EMPTY);
-        result.needsFullRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a TORCH!");
-        }
+        result.needsRedraw = true;
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, GameConfig::CHAR_TORCH));
         return result;
     }
 
     // Bomb pickup
     Bomb* bomb = objects->getBombAt(pos);
     if (bomb && bomb->isIdle() && !player.hasItem()) {
-        bomb->collect();
+        objects->collectBomb(*bomb);
         player.pickupItem('B');
         board->setCell(pos, GameConfig::CHAR_EMPTY);
         result.needsRedraw = true;
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Picked up a BOMB! Press drop key to plant.");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemPickedUp, playerNum, pos, 'B'));
         return result;
     }
 
@@ -184,7 +148,7 @@ InteractionResult InteractionHandler::handleInteractions(Player& player) {
 }
 
 // Attempt to open gate using player's key
-bool InteractionHandler::tryOpenGate(Player& player, const Point& nextPos) {
+bool InteractionHandler::tryOpenGate(Player& player, int playerNum, const Point& nextPos, StepEvents& events) {
     if (!objects) return false;
 
     Gate* gate = objects->getGateAt(nextPos);
@@ -192,70 +156,49 @@ bool InteractionHandler::tryOpenGate(Player& player, const Point& nextPos) {
         if (player.hasKey()) {
             player.disposeItem();
             openGate(*gate);
-            if (statusBar && lighting) {
-                statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-                statusBar->draw();
-            }
-            if (messageDisplay) {
-                messageDisplay->show("Gate opened!");
-            }
+            events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+            events.push(StepEvent(StepEventType::GateOpened, playerNum, Point(gate->getX(), gate->getY()),
+                                  gate->getWidth(), gate->getHeight()));
             return true;
         }
         else {
-            if (messageDisplay) {
-                messageDisplay->show("You need a KEY to open this gate!");
-            }
+            events.push(StepEvent(StepEventType::NeedKey, playerNum, nextPos));
         }
     }
     return false;
 }
 
 // Drop held item (key, torch, or plant bomb)
-void InteractionHandler::dropPlayerItem(Player& player) {
+void InteractionHandler::dropPlayerItem(Player& player, int playerNum, StepEvents& events) {
     if (!objects) return;
 
     if (player.hasKey()) {
         player.disposeItem();
         objects->dropKey(player.getPosition());
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Dropped a KEY!");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemDropped, playerNum, player.getPosition(), GameConfig::CHAR_KEY));
     }
     else if (player.hasTorch()) {
         player.disposeItem();
+        // A torch dropped on brush sets it alight and burns away with it
+        if (fire && fire->ignite(player.getPosition())) {
+            events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+            events.push(StepEvent(StepEventType::FireStarted, playerNum, player.getPosition()));
+            return;
+        }
         int radius = lighting ? lighting->getTorchRadius() : 5;
         objects->dropTorch(player.getPosition(), radius);
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("Dropped a TORCH!");
-        }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemDropped, playerNum, player.getPosition(), GameConfig::CHAR_TORCH));
     }
     else if (player.hasBomb()) {
         player.disposeItem();
-        // Find the collected bomb and activate it
-        for (auto& bomb : objects->getBombs()) {
-            if (bomb->isCollected()) {
-                bomb->activate(player.getPosition());
-                if (board) {
-                    board->setCell(player.getPosition(), GameConfig::CHAR_EMPTY);
-                }
-                break;
-            }
-        }
-        if (statusBar && lighting) {
-            statusBar->setDarkRoomStatus(lighting->getIsDarkRoom(), lighting->isRoomLit());
-            statusBar->draw();
-        }
-        if (messageDisplay) {
-            messageDisplay->show("BOMB PLANTED! 5 cycles to explosion!");
+        // Plant the carried bomb and start its countdown
+        if (objects->plantCollectedBomb(player.getPosition()) && board) {
+            board->setCell(player.getPosition(), GameConfig::CHAR_EMPTY);
         }
+        events.push(StepEvent(StepEventType::StatusChanged, playerNum));
+        events.push(StepEvent(StepEventType::ItemDropped, playerNum, player.getPosition(), 'B'));
     }
 }
 
@@ -271,14 +214,18 @@ void InteractionHandler::closeGate(Gate& gate) {
     gate.updateBoard(board->getRawBoard());
 }
 
+// Riddle panel sits below the message line so messages keep showing while a riddle is open
+static const int RIDDLE_PANEL_Y = GameConfig::GAME_HEIGHT + 2;
+static const int RIDDLE_PANEL_LINES = 6;
+
 // Display riddle question and answer options
-void InteractionHandler::displayRiddleUI(const Riddle& riddle) {
+void InteractionHandler::displayRiddleUI(const Riddle& riddle, int playerNum) {
     // #region agent log H4: Log which riddle is being displayed
     { std::ofstream dbg("c:\\Users\\admin\\source\\repos\\GameProject\\Exe_2\\.cursor\\debug.log", std::ios::app); std::string q = riddle.getQuestion(); dbg << "{\"location\":\"InteractionHandler.cpp:displayRiddleUI\",\"message\":\"Displaying riddle\",\"data\":{\"question\":\"" << q.substr(0, 60) << "\"},\"hypothesisId\":\"H4\",\"timestamp\":" << time(nullptr) << "}\n"; }
     // #endregion
-    int startY = GameConfig::GAME_HEIGHT + 1;
+    int startY = RIDDLE_PANEL_Y;
 
-    for (int i = 0; i < 7; i++) {
+    for (int i = 0; i < RIDDLE_PANEL_LINES; i++) {
         gotoxy(0, startY + i);
         std::cout << std::string(GameConfig::GAME_WIDTH, ' ');
     }
@@ -290,103 +237,54 @@ void InteractionHandler::displayRiddleUI(const Riddle& riddle) {
     const auto& options = riddle.getOptions();
     char optionChar = 'a';
     for (size_t i = 0; i < options.size() && i < 4; i++) {
-        gotoxy(2, startY + 2 + (int)i);
+        gotoxy(2, startY + 1 + (int)i);
         setColor(Color::White);
         std::cout << optionChar << ") " << options[i];
         optionChar++;
     }
 
-    gotoxy(0, startY + 6);
+    gotoxy(0, startY + 5);
     setColor(Color::LightCyan);
-    std::cout << "Press a, b, c, or d to answer: ";
+    const char* keys = (playerNum == 2) ? GameConfig::P2_ANSWER_KEYS : GameConfig::P1_ANSWER_KEYS;
+    std::cout << "Player " << playerNum << ": press " << (char)std::tolower(keys[0]) << ", "
+              << (char)std::tolower(keys[1]) << ", " << (char)std::tolower(keys[2]) << ", or "
+              << (char)std::tolower(keys[3]) << " to answer: ";
     resetColor();
     std::cout.flush();
 }
 
 void InteractionHandler::clearRiddleUI() {
-    int startY = GameConfig::GAME_HEIGHT + 1;
-    for (int i = 0; i < 7; i++) {
-        gotoxy(0, startY + i);
+    for (int i = 0; i < RIDDLE_PANEL_LINES; i++) {
+        gotoxy(0, RIDDLE_PANEL_Y + i);
         std::cout << std::string(GameConfig::GAME_WIDTH, ' ');
     }
     std::cout.flush();
 }
 
-// AI-assisted: Wait for riddle answer with input buffer flush
-// In load mode, retrieves answer from recorded steps instead
-char InteractionHandler::waitForRiddleAnswer(int playerNum) {
-    // In load mode, get the answer from recorded steps
-    if (recorder && recorder->isLoadMode()) {
-        char recordedAnswer = recorder->getRiddleAnswer(playerNum);
-        if (recordedAnswer != '\0') {
-            return recordedAnswer;
-        }
-        // Fallback if no recorded answer found
-        return 'a';
-    }
-    
-    // Normal/save mode: wait for keyboard input
-    while (_kbhit()) _getch();
-
-    while (true) {
-        if (_kbhit()) {
-            char ch = (char)_getch();
-            ch = static_cast<char>(std::tolower(ch));
-            if (ch == 'a' || ch == 'b' || ch == 'c' || ch == 'd') {
-                return ch;
-            }
-        }
-        Sleep(10);
-    }
+// Show the riddle; the answer comes back through the player's input on a later cycle
+void InteractionHandler::showRiddle(const Riddle& riddle, int playerNum) {
+    if (recorder && recorder->isSilentMode()) return;
+    displayRiddleUI(riddle, playerNum);
 }
 
-// Display riddle, get answer, check correctness, update lives
-bool InteractionHandler::handleRiddle(Player& player, Riddle& riddle, int playerNum) {
-    // In silent mode, skip UI entirely
-    bool isSilent = recorder && recorder->isSilentMode();
-    
-    if (!isSilent) {
-        displayRiddleUI(riddle);
-    }
-
-    char answer = waitForRiddleAnswer(playerNum);
-    lastRiddleAnswer = answer;  // Store for recording
-    
-    // Record the answer in save mode
-    if (recorder && recorder->isSaveMode()) {
-        recorder->recordRiddleAnswer(playerNum, answer);
-    }
-    
-    bool correct = riddle.checkAnswer(answer);
-
-    int startY = GameConfig::GAME_HEIGHT + 1;
+// Show answer feedback (GameLevel closes the panel once the feedback cycles are over)
+void InteractionHandler::showRiddleResult(bool correct) {
+    if (recorder && recorder->isSilentMode()) return;
 
+    gotoxy(0, RIDDLE_PANEL_Y + 5);
     if (correct) {
-        if (!isSilent) {
-            gotoxy(0, startY + 6);
-            setColor(Color::LightGreen);
-            std::cout << "CORRECT! Well done!                    ";
-            resetColor();
-            std::cout.flush();
-            Sleep(1500);
-        }
+        setColor(Color::LightGreen);
+        std::cout << "CORRECT! Well done!                    ";
     }
     else {
-        LivesManager::subtractLife();
-
-        if (!isSilent) {
-            gotoxy(0, startY + 6);
-            setColor(Color::LightRed);
-            std::cout << "WRONG! Lives remaining: " << LivesManager::getLives() << "        ";
-            resetColor();
-            std::cout.flush();
-            Sleep(2000);
-        }
-    }
-
-    if (!isSilent) {
-        clearRiddleUI();
+        setColor(Color::LightRed);
+        std::cout << "WRONG! Lives remaining: " << LivesManager::getLives() << "        ";
     }
+    resetColor();
+    std::cout.flush();
+}
 
-    return correct;
+void InteractionHandler::clearRiddle() {
+    if (recorder && recorder->isSilentMode()) return;
+    clearRiddleUI();
 }
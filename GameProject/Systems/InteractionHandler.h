@@ -6,9 +6,9 @@
 #include "ObjectManager.h"
 #include "GameBoard.h"
 #include "LightingSystem.h"
-#include "StatusBar.h"
-#include "MessageDisplay.h"
+#include "FireSystem.h"
 #include "Riddle.h"
+#include "LevelStep.h"
 
 class Game;
 class GameRecorder;
@@ -28,17 +28,13 @@ private:
     ObjectManager* objects;
     GameBoard* board;
     LightingSystem* lighting;
-    StatusBar* statusBar;
-    MessageDisplay* messageDisplay;
+    FireSystem* fire;
     Game* game;
     GameRecorder* recorder;
 
     // Track riddle to prevent re-trigger
     Riddle* lastTriggeredRiddle;
     Point lastRiddlePos;
-    
-    // Store last riddle answer for recording
-    char lastRiddleAnswer;
 
 public:
     InteractionHandler();
@@ -47,32 +43,29 @@ public:
     void setObjectManager(ObjectManager* obj);
     void setBoard(GameBoard* b);
     void setLightingSystem(LightingSystem* light);
-    void setStatusBar(StatusBar* status);
-    void setMessageDisplay(MessageDisplay* msg);
+    void setFireSystem(FireSystem* f);
     void setGame(Game* g);
     void setRecorder(GameRecorder* rec);
-    
-    // Get last riddle answer (for recording)
-    char getLastRiddleAnswer() const { return lastRiddleAnswer; }
 
-    // Handle interactions at position
-    InteractionResult handleInteractions(Player& player);
+    // Handle interactions at position (messages and status changes go to events)
+    InteractionResult handleInteractions(Player& player, int playerNum, StepEvents& events);
 
     // Gate handling (returns true if opened)
-    bool tryOpenGate(Player& player, const Point& nextPos);
+    bool tryOpenGate(Player& player, int playerNum, const Point& nextPos, StepEvents& events);
 
     // Item drop
-    void dropPlayerItem(Player& player);
+    void dropPlayerItem(Player& player, int playerNum, StepEvents& events);
 
     // Open/close gate
     void openGate(Gate& gate);
     void closeGate(Gate& gate);
 
-    // Riddle (blocking - freezes game, returns true if correct)
-    bool handleRiddle(Player& player, Riddle& riddle, int playerNum);
+    // Riddle UI (drawing only - the riddle modal itself lives in GameLevel)
+    void showRiddle(const Riddle& riddle, int playerNum);
+    void showRiddleResult(bool correct);
+    void clearRiddle();
 
 private:
-    void displayRiddleUI(const Riddle& riddle);
+    void displayRiddleUI(const Riddle& riddle, int playerNum);
     void clearRiddleUI();
-    char waitForRiddleAnswer(int playerNum);
 };
\ No newline at end of file
@@ -0,0 +1,61 @@
+// KeyboardThread.cpp - Console polling thread and SPSC key ring
+
+#include "KeyboardThread.h"
+#include "console.h"
+
+// Ring: indices grow forever and wrap by masking; head - tail is the fill level.
+// The release store publishes the slot, the acquire load on the other side sees it.
+bool KeyRing::push(const KeyEvent& e) {
+    unsigned h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == CAPACITY) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    slots[h & (CAPACITY - 1)] = e;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+bool KeyRing::pop(KeyEvent& e) {
+    unsigned t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    e = slots[t & (CAPACITY - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+bool KeyRing::empty() const {
+    return tail.load(std::memory_order_relaxed) == head.load(std::memory_order_acquire);
+}
+
+void KeyRing::flush() {
+    tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+KeyboardThread::KeyboardThread() : running(false) {
+}
+
+KeyboardThread::~KeyboardThread() {
+    stop();
+}
+
+void KeyboardThread::start() {
+    if (running.load()) return;
+    running.store(true);
+    worker = std::thread(&KeyboardThread::run, this);
+}
+
+void KeyboardThread::stop() {
+    if (!running.exchange(false)) return;
+    if (worker.joinable()) worker.join();
+}
+
+// Producer: read every key the console has, stamp it, then nap briefly
+void KeyboardThread::run() {
+    while (running.load()) {
+        while (_kbhit()) {
+            ring.push(KeyEvent((char)_getch(), std::chrono::steady_clock::now()));
+        }
+        Sleep(POLL_MS);
+    }
+}
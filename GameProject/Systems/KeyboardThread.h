@@ -0,0 +1,75 @@
+// KeyboardThread.h - Dedicated keyboard reader feeding a lock-free key ring
+// A background thread polls the console and stamps each raw key with a monotonic
+// time as it arrives; the game drains the ring at tick boundaries. The ring has one
+// producer (the thread) and one consumer (the game loop), so it needs no locks.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// One raw key press and when it was read
+struct KeyEvent {
+    char key;
+    std::chrono::steady_clock::time_point time;
+
+    KeyEvent() : key('\0') {}
+    KeyEvent(char k, std::chrono::steady_clock::time_point t) : key(k), time(t) {}
+};
+
+// Single-producer / single-consumer ring (full ring drops new keys)
+class KeyRing {
+public:
+    static const unsigned CAPACITY = 64;  // power of two
+
+private:
+    std::array<KeyEvent, CAPACITY> slots;
+    std::atomic<unsigned> head;  // Next write (producer only)
+    std::atomic<unsigned> tail;  // Next read (consumer only)
+    std::atomic<unsigned> dropped;
+
+public:
+    KeyRing() : head(0), tail(0), dropped(0) {}
+
+    // Producer side
+    bool push(const KeyEvent& e);
+
+    // Consumer side
+    bool pop(KeyEvent& e);
+    bool empty() const;
+    void flush();
+
+    unsigned getDropped() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+class KeyboardThread {
+private:
+    KeyRing ring;
+    std::thread worker;
+    std::atomic<bool> running;
+
+    static const int POLL_MS = 1;
+
+    void run();
+
+public:
+    KeyboardThread();
+    ~KeyboardThread();
+
+    KeyboardThread(const KeyboardThread&) = delete;
+    KeyboardThread& operator=(const KeyboardThread&) = delete;
+
+    // The thread owns the console keyboard while running; screens that read
+    // the console directly (menus, "press any key") need it stopped
+    void start();
+    void stop();
+    bool isRunning() const { return running.load(); }
+
+    // Consumer side (game loop thread)
+    bool poll(KeyEvent& e) { return ring.pop(e); }
+    void flush() { ring.flush(); }
+
+    unsigned getDroppedKeys() const { return ring.getDropped(); }
+};
@@ -0,0 +1,62 @@
+// LevelPreloader.cpp - Door-target preparation queue and its worker
+
+#include "LevelPreloader.h"
+#include "GameLevel.h"
+#include <algorithm>
+
+LevelPreloader::LevelPreloader() : busy(nullptr), running(false) {
+}
+
+LevelPreloader::~LevelPreloader() {
+    stop();
+}
+
+void LevelPreloader::request(const std::vector<GameLevel*>& levels) {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.assign(levels.begin(), levels.end());
+    if (!running) {
+        running = true;
+        worker = std::thread(&LevelPreloader::run, this);
+    }
+    workReady.notify_one();
+}
+
+void LevelPreloader::claim(GameLevel* level) {
+    std::unique_lock<std::mutex> lock(mutex);
+    queue.erase(std::remove(queue.begin(), queue.end(), level), queue.end());
+    levelDone.wait(lock, [this, level] { return busy != level; });
+}
+
+void LevelPreloader::cancel() {
+    std::unique_lock<std::mutex> lock(mutex);
+    queue.clear();
+    levelDone.wait(lock, [this] { return busy == nullptr; });
+}
+
+void LevelPreloader::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!running) return;
+        running = false;
+        queue.clear();
+    }
+    workReady.notify_one();
+    if (worker.joinable()) worker.join();
+}
+
+// Prepare queued levels one at a time; the lock is only held to pick the next one
+void LevelPreloader::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workReady.wait(lock, [this] { return !running || !queue.empty(); });
+        if (!running) break;
+
+        busy = queue.front();
+        queue.pop_front();
+        lock.unlock();
+        busy->prepare();
+        lock.lock();
+        busy = nullptr;
+        levelDone.notify_all();
+    }
+}
@@ -0,0 +1,44 @@
+// LevelPreloader.h - Worker thread that gets door-target levels ready ahead of time
+// While the players walk around a level, the levels its doors lead to are restored and
+// their first frame composed on a worker, so crossing a door only has to reset the
+// per-visit state and write the frame. A level is only ever touched by one thread at a
+// time: the game claims a level from the worker before it enters it.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class GameLevel;
+
+class LevelPreloader {
+private:
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable workReady;  // Worker: something queued, or stopping
+    std::condition_variable levelDone;  // Game: the level being prepared is finished
+    std::deque<GameLevel*> queue;
+    GameLevel* busy;                    // Being prepared right now (nullptr = idle)
+    bool running;
+
+    void run();
+
+public:
+    LevelPreloader();
+    ~LevelPreloader();
+
+    // Queue levels to prepare, replacing any still waiting (starts the worker)
+    void request(const std::vector<GameLevel*>& levels);
+
+    // Take a level back from the worker: waits if it is being prepared right now,
+    // drops it from the queue otherwise. The caller owns it afterwards.
+    void claim(GameLevel* level);
+
+    // Drop the queue and wait until the worker is idle (before levels are destroyed)
+    void cancel();
+
+    void stop();
+};
@@ -5,10 +5,12 @@
 #include "console.h"
 #include <algorithm>
 #include <iostream>
+#include <string>
 
 // Constructor
 LevelRenderer::LevelRenderer()
-    : board(nullptr), lighting(nullptr), player1(nullptr), player2(nullptr), silentMode(false) {
+    : board(nullptr), lighting(nullptr), player1(nullptr), player2(nullptr), silentMode(false),
+    frameReady(false) {
 }
 
 // Setup
@@ -29,69 +31,97 @@ void LevelRenderer::setSilentMode(bool silent) {
     silentMode = silent;
 }
 
-// Draw single cell
-void LevelRenderer::drawCell(int x, int y) const {
-    if (silentMode || !board) return;
+bool LevelRenderer::isVisible(int x, int y) const {
+    return lighting ? lighting->isCellVisible(x, y) : true;
+}
 
-    bool visible = lighting ? lighting->isCellVisible(x, y) : true;
+// Console color of a visible cell
+static Color cellColor(char c) {
+    switch (c) {
+    case GameConfig::CHAR_WALL: return Color::Gray;
+    case GameConfig::CHAR_KEY: return Color::Yellow;
+    case GameConfig::CHAR_COIN: return Color::Yellow;
+    case GameConfig::CHAR_TORCH: return Color::LightRed;
+    case '/': return Color::LightGreen;  // Switch ON
+    case '\\': return Color::Gray;       // Switch OFF
+    case '-':
+    case '|': return Color::Red;
+    case '+': return Color::Green;
+    case GameConfig::CHAR_BRUSH: return Color::Green;
+    case GameConfig::CHAR_FIRE: return Color::LightRed;
+    default:
+        return (c >= '1' && c <= '9') ? Color::Magenta : Color::White;
+    }
+}
+
+// Draw single cell (remembered cells are drawn dimmed)
+void LevelRenderer::drawCell(int x, int y) {
+    if (silentMode || !board) return;
+    if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return;
+
+    bool visible = isVisible(x, y);
+    shownRows[y][x] = visible;
+    if (!visible && lighting && lighting->isCellRemembered(x, y)) {
+        gotoxy(x, y);
+        ::setColor(Color::Gray);
+        std::cout << board->getCell(x, y);
+        resetColor();
+        return;
+    }
     board->drawCell(x, y, visible);
 }
 
-// Draw entire board
-void LevelRenderer::drawBoard() const {
+// Composite each row from visible, remembered and hidden cells into runs of one
+// color. Reads only this level's board and light map, so it can run off the main thread.
+void LevelRenderer::composeBoard() {
     if (silentMode || !board) return;
 
     for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
-        gotoxy(0, y);
-        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
-            bool visible = lighting ? lighting->isCellVisible(x, y) : true;
+        frameVisible[y] = lighting ? lighting->getVisibleRow(y) : BoardRowMask().set();
+        BoardRowMask remembered;
+        if (lighting) remembered = lighting->getExploredRow(y) & ~frameVisible[y];
 
-            if (!visible) {
-                ::setColor(Color::Black);
-                std::cout << ' ';
-                continue;
+        std::vector<ColorRun>& runs = frameRows[y];
+        runs.clear();
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            char c = ' ';
+            Color color = Color::Black;
+            if (frameVisible[y][x]) {
+                c = board->getCell(x, y);
+                color = cellColor(c);
             }
-
-            char c = board->getCell(x, y);
-            switch (c) {
-            case GameConfig::CHAR_WALL:
-                ::setColor(Color::Gray);
-                break;
-            case GameConfig::CHAR_KEY:
-                ::setColor(Color::Yellow);
-                break;
-            case GameConfig::CHAR_COIN:
-                ::setColor(Color::Yellow);
-                break;
-            case GameConfig::CHAR_TORCH:
-                ::setColor(Color::LightRed);
-                break;
-            case '/':
-                ::setColor(Color::LightGreen);  // Switch ON
-                break;
-            case '\\':
-                ::setColor(Color::Gray);  // Switch OFF
-                break;
-            case '-':
-            case '|':
-                ::setColor(Color::Red);
-                break;
-            case '+':
-                ::setColor(Color::Green);
-                break;
-            default:
-                if (c >= '1' && c <= '9') {
-                    ::setColor(Color::Magenta);
-                }
-                else {
-                    ::setColor(Color::White);
-                }
-                break;
+            else if (remembered[x]) {
+                c = board->getCell(x, y);
+                color = Color::Gray;
             }
-            std::cout << c;
+
+            if (runs.empty() || runs.back().color != color) runs.push_back(ColorRun{ color, std::string() });
+            runs.back().text += c;
+        }
+    }
+    frameReady = true;
+}
+
+void LevelRenderer::discardComposed() {
+    frameReady = false;
+}
+
+// Draw entire board, written as runs of one color instead of cell by cell
+// (a frame composed ahead of time is written as is)
+void LevelRenderer::drawBoard() {
+    if (silentMode || !board) return;
+    if (!frameReady) composeBoard();
+
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        gotoxy(0, y);
+        shownRows[y] = frameVisible[y];
+        for (const ColorRun& run : frameRows[y]) {
+            ::setColor(run.color);
+            std::cout << run.text;
         }
         resetColor();
     }
+    frameReady = false;
 }
 
 // Draw players
@@ -101,18 +131,15 @@ void LevelRenderer::drawPlayers() const {
     if (player2) player2->draw();
 }
 
-// Redraw torch area
-void LevelRenderer::redrawTorchArea(int centerX, int centerY, int radius) const {
-    if (silentMode || !board) return;
-
-    int startX = (std::max)(0, centerX - radius);
-    int endX = (std::min)(GameConfig::GAME_WIDTH - 1, centerX + radius);
-    int startY = (std::max)(0, centerY - radius);
-    int endY = (std::min)(GameConfig::GAME_HEIGHT - 1, centerY + radius);
+// Diff shown visibility against the current light map, one row mask at a time
+void LevelRenderer::redrawVisibilityChanges() {
+    if (silentMode || !board || !lighting) return;
 
-    for (int y = startY; y <= endY; y++) {
-        for (int x = startX; x <= endX; x++) {
-            drawCell(x, y);
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        BoardRowMask changed = lighting->getVisibleRow(y) ^ shownRows[y];
+        if (changed.none()) continue;
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            if (changed[x]) drawCell(x, y);
         }
     }
-}
\ No newline at end of file
+}
@@ -5,6 +5,8 @@
 #include "GameBoard.h"
 #include "LightingSystem.h"
 #include "Player.h"
+#include <string>
+#include <vector>
 
 class LevelRenderer {
 private:
@@ -14,6 +16,21 @@ private:
     Player* player2;
     bool silentMode;
 
+    // Visibility each cell was last drawn with (lets light changes redraw only the difference)
+    BoardRowMask shownRows[GameConfig::GAME_HEIGHT];
+
+    // Full frame as runs of one color per row, with the visibility it was built for.
+    // Built by drawBoard, or ahead of time by composeBoard (then drawBoard only writes it).
+    struct ColorRun {
+        Color color;
+        std::string text;
+    };
+    std::vector<ColorRun> frameRows[GameConfig::GAME_HEIGHT];
+    BoardRowMask frameVisible[GameConfig::GAME_HEIGHT];
+    bool frameReady;
+
+    bool isVisible(int x, int y) const;
+
 public:
     LevelRenderer();
 
@@ -24,8 +41,13 @@ public:
     void setSilentMode(bool silent);
 
     // Drawing
-    void drawCell(int x, int y) const;
-    void drawBoard() const;
+    void drawCell(int x, int y);
+    void drawBoard();
+    void composeBoard();      // Build the next full frame without touching the console
+    void discardComposed();
     void drawPlayers() const;
-    void redrawTorchArea(int centerX, int centerY, int radius) const;
+
+    // Redraw only cells whose visibility changed since they were last drawn
+    // (the leading and trailing edges of a moving torch)
+    void redrawVisibilityChanges();
 };
\ No newline at end of file
@@ -1,21 +1,26 @@
 // LightingSystem.cpp - Dark room visibility calculations
 // Handles torch light radius, light switches, and cell visibility
 // AI usage: Distance-squared optimization for torch light (AI-assisted)
+// Torch light is kept as a bitmap rebuilt only when a light source changes.
+// Each torch casts a wall-occluded field (symmetric shadowcasting) clipped to its
+// disc; fields are cached per torch until it moves or a nearby wall changes.
 
 #include "LightingSystem.h"
+#include <algorithm>
 
 DroppedTorch::DroppedTorch(int x, int y, int radius)
     : position(x, y), collected(false), lightRadius(radius) {
 }
 
 LightingSystem::LightingSystem()
-    : isDarkRoom(false), torchRadius(3),
-    lightSwitches(nullptr), torches(nullptr), droppedTorches(nullptr),
+    : isDarkRoom(false), torchRadius(3), lightMapDirty(true),
+    board(nullptr), signals(nullptr), roomLightSignal(-1), torches(nullptr), droppedTorches(nullptr),
     player1(nullptr), player2(nullptr) {
 }
 
 // Dependency injection
-void LightingSystem::setLightSwitches(const std::vector<std::unique_ptr<LightSwitch>>* sw) { lightSwitches = sw; }
+void LightingSystem::setBoard(const GameBoard* b) { board = b; }
+void LightingSystem::setRoomLight(const SignalGraph* graph, int consumer) { signals = graph; roomLightSignal = consumer; }
 void LightingSystem::setTorches(const std::vector<std::unique_ptr<Torch>>* t) { torches = t; }
 void LightingSystem::setDroppedTorches(const std::vector<DroppedTorch>* dt) { droppedTorches = dt; }
 void LightingSystem::setPlayers(const Player* p1, const Player* p2) { player1 = p1; player2 = p2; }
@@ -25,67 +30,222 @@ bool LightingSystem::getIsDarkRoom() const { return isDarkRoom; }
 void LightingSystem::setTorchRadius(int radius) { torchRadius = radius; }
 int LightingSystem::getTorchRadius() const { return torchRadius; }
 
-// Check if room is lit by any light switch
+// Check if the light switches light the room (O(1) counter lookup)
 bool LightingSystem::isRoomLit() const {
     if (!isDarkRoom) return true;
+    return signals && signals->isSatisfied(roomLightSignal);
+}
+
+// Every torch currently giving light: held torches use the level radius
+void LightingSystem::collectEmitters(std::vector<Emitter>& out) const {
+    out.clear();
 
-    if (lightSwitches) {
-        for (const auto& sw : *lightSwitches) {
-            if (sw->isActive() && sw->getIsOn()) {
-                return true;
+    if (player1 && player1->hasTorch()) out.push_back(Emitter(player1->getPosition(), torchRadius));
+    if (player2 && player2->hasTorch()) out.push_back(Emitter(player2->getPosition(), torchRadius));
+
+    if (torches) {
+        for (const auto& torch : *torches) {
+            if (torch->isActive() && !torch->isCollected()) {
+                out.push_back(Emitter(torch->getPosition(), torch->getLightRadius()));
             }
         }
     }
-    return false;
+
+    if (droppedTorches) {
+        for (const auto& dt : *droppedTorches) {
+            if (!dt.collected) out.push_back(Emitter(dt.position, dt.lightRadius));
+        }
+    }
 }
 
-// AI-assisted: Check if cell is lit by any torch (uses distance^2 to avoid sqrt)
-bool LightingSystem::isInTorchLight(int x, int y) const {
-    Point p(x, y);
-
-    // Player 1's held torch
-    if (player1 && player1->hasTorch()) {
-        int dx = x - player1->getPosition().getX();
-        int dy = y - player1->getPosition().getY();
-        if ((dx * dx + dy * dy) <= (torchRadius * torchRadius)) {
-            return true;
+// AI-assisted: Disc rows for dx^2 + dy^2 <= r^2 (computed once per radius)
+const std::vector<int>& LightingSystem::getDiscSpans(int radius) {
+    if ((int)discSpans.size() <= radius) discSpans.resize(radius + 1);
+    std::vector<int>& spans = discSpans[radius];
+    if (spans.empty()) {
+        for (int dy = -radius; dy <= radius; dy++) {
+            int halfWidth = 0;
+            while ((halfWidth + 1) * (halfWidth + 1) + dy * dy <= radius * radius) halfWidth++;
+            spans.push_back(halfWidth);
         }
     }
+    return spans;
+}
+
+BoardRowMask LightingSystem::spanMask(int x0, int x1) const {
+    x0 = (std::max)(0, x0);
+    x1 = (std::min)(GameConfig::GAME_WIDTH - 1, x1);
+    BoardRowMask span;
+    if (x0 > x1) return span;
+    span.set();
+    span >>= GameConfig::GAME_WIDTH - (x1 - x0 + 1);
+    return span << x0;
+}
 
-    // Player 2's held torch
-    if (player2 && player2->hasTorch()) {
-        int dx = x - player2->getPosition().getX();
-        int dy = y - player2->getPosition().getY();
-        if ((dx * dx + dy * dy) <= (torchRadius * torchRadius)) {
-            return true;
+// Walls and everything outside the board stop light
+bool LightingSystem::isOpaque(int x, int y) const {
+    if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return true;
+    return board && board->getWallRow(y)[x];
+}
+
+// Floor division for a possibly negative numerator (den > 0)
+static int floorDiv(int num, int den) {
+    return (num >= 0) ? num / den : -((-num + den - 1) / den);
+}
+
+// AI-assisted: Symmetric shadowcasting, one row of one quadrant.
+// Slopes are fractions num/den (den > 0); a cell is lit if it is a wall hit by
+// light or its centre lies inside the row's slope range, which keeps light symmetric.
+void LightingSystem::scanRow(Emitter& emitter, int quadrant, int depth,
+                             int startNum, int startDen, int endNum, int endDen) {
+    if (depth > emitter.radius) return;
+
+    int ox = emitter.pos.getX();
+    int oy = emitter.pos.getY();
+    int top = oy - emitter.radius;
+
+    // round half up / round half down of depth * slope
+    int minCol = floorDiv(2 * depth * startNum + startDen, 2 * startDen);
+    int maxCol = -floorDiv(-(2 * depth * endNum - endDen), 2 * endDen);
+
+    bool hasPrev = false;
+    bool prevWall = false;
+    for (int col = minCol; col <= maxCol; col++) {
+        int x = ox + col, y = oy - depth;                       // 0: up
+        if (quadrant == 1) { x = ox + depth; y = oy + col; }    // 1: right
+        else if (quadrant == 2) { x = ox + col; y = oy + depth; }  // 2: down
+        else if (quadrant == 3) { x = ox - depth; y = oy + col; }  // 3: left
+
+        bool wall = isOpaque(x, y);
+        bool symmetric = col * startDen >= depth * startNum && col * endDen <= depth * endNum;
+        if ((wall || symmetric) && x >= 0 && x < GameConfig::GAME_WIDTH &&
+            y >= 0 && y < GameConfig::GAME_HEIGHT) {
+            emitter.field[y - top][x] = true;
         }
+
+        if (hasPrev && prevWall && !wall) {
+            startNum = 2 * col - 1;
+            startDen = 2 * depth;
+        }
+        if (hasPrev && !prevWall && wall) {
+            scanRow(emitter, quadrant, depth + 1, startNum, startDen, 2 * col - 1, 2 * depth);
+        }
+        hasPrev = true;
+        prevWall = wall;
+    }
+    if (hasPrev && !prevWall) {
+        scanRow(emitter, quadrant, depth + 1, startNum, startDen, endNum, endDen);
     }
+}
 
-    // Placed torches
-    if (torches) {
-        for (const auto& torch : *torches) {
-            if (torch->isActive() && !torch->isCollected()) {
-                if (torch->isInLightRadius(p)) {
-                    return true;
-                }
+// Field of view of one torch, clipped to its light disc
+void LightingSystem::castField(Emitter& emitter) {
+    int r = (std::max)(0, emitter.radius);
+    int cx = emitter.pos.getX();
+    emitter.field.assign(2 * r + 1, BoardRowMask());
+    if (!emitter.pos.isInBounds()) return;
+
+    emitter.field[r][cx] = true;
+    for (int quadrant = 0; quadrant < 4; quadrant++) {
+        scanRow(emitter, quadrant, 1, -1, 1, 1, 1);
+    }
+
+    const std::vector<int>& spans = getDiscSpans(r);
+    for (int dy = -r; dy <= r; dy++) {
+        emitter.field[dy + r] &= spanMask(cx - spans[dy + r], cx + spans[dy + r]);
+    }
+}
+
+// True if a wall changed inside the square the emitter's light can reach
+bool LightingSystem::wallsChangedNear(const Emitter& emitter, const BoardRowMask* changed) const {
+    int r = emitter.radius;
+    BoardRowMask reach = spanMask(emitter.pos.getX() - r, emitter.pos.getX() + r);
+    int y0 = (std::max)(0, emitter.pos.getY() - r);
+    int y1 = (std::min)(GameConfig::GAME_HEIGHT - 1, emitter.pos.getY() + r);
+    for (int y = y0; y <= y1; y++) {
+        if ((changed[y] & reach).any()) return true;
+    }
+    return false;
+}
+
+bool LightingSystem::update() {
+    std::vector<Emitter> current;
+    collectEmitters(current);
+
+    // Walls that appeared or were blown away since the last update
+    BoardRowMask changed[GameConfig::GAME_HEIGHT];
+    bool anyWallChanged = false;
+    if (board) {
+        for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+            changed[y] = board->getWallRow(y) ^ wallSnapshot[y];
+            if (changed[y].any()) {
+                anyWallChanged = true;
+                wallSnapshot[y] = board->getWallRow(y);
             }
         }
     }
 
-    // Dropped torches
-    if (droppedTorches) {
-        for (const auto& dt : *droppedTorches) {
-            if (!dt.collected) {
-                int dx = x - dt.position.getX();
-                int dy = y - dt.position.getY();
-                if ((dx * dx + dy * dy) <= (dt.lightRadius * dt.lightRadius)) {
-                    return true;
-                }
+    // Reuse the cached field of every torch that did not move and saw no wall change
+    // (the union does not depend on emitter order)
+    bool recast = lightMapDirty || current.size() != emitters.size();
+    for (Emitter& e : current) {
+        auto cached = std::find(emitters.begin(), emitters.end(), e);
+        if (!lightMapDirty && cached != emitters.end() && !cached->field.empty() &&
+            !(anyWallChanged && wallsChangedNear(*cached, changed))) {
+            e.field.swap(cached->field);
+        }
+        else {
+            castField(e);
+            recast = true;
+        }
+    }
+
+    emitters.swap(current);
+    lightMapDirty = false;
+
+    if (recast) {
+        for (auto& row : litRows) row.reset();
+        for (const auto& emitter : emitters) {
+            int top = emitter.pos.getY() - emitter.radius;
+            for (int i = 0; i < (int)emitter.field.size(); i++) {
+                int y = top + i;
+                if (y >= 0 && y < GameConfig::GAME_HEIGHT) litRows[y] |= emitter.field[i];
             }
         }
     }
 
-    return false;
+    // Fog of war: whatever is visible now has been explored
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        exploredRows[y] |= getVisibleRow(y);
+    }
+    return recast;
+}
+
+void LightingSystem::invalidate() { lightMapDirty = true; }
+
+const BoardRowMask& LightingSystem::getLitRow(int y) const { return litRows[y]; }
+
+BoardRowMask LightingSystem::getVisibleRow(int y) const {
+    if (!isDarkRoom || isRoomLit()) return BoardRowMask().set();
+    return litRows[y];
+}
+
+// Fog of war
+const BoardRowMask& LightingSystem::getExploredRow(int y) const { return exploredRows[y]; }
+void LightingSystem::setExploredRow(int y, const BoardRowMask& row) { exploredRows[y] = row; }
+void LightingSystem::clearExplored() {
+    for (auto& row : exploredRows) row.reset();
+}
+
+bool LightingSystem::isCellRemembered(int x, int y) const {
+    if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return false;
+    return exploredRows[y][x] && !isCellVisible(x, y);
+}
+
+// Check if cell is lit by any torch (as of the last update)
+bool LightingSystem::isInTorchLight(int x, int y) const {
+    if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return false;
+    return litRows[y][x];
 }
 
 // Determine if cell should be rendered (lit room, torch light, or not dark)
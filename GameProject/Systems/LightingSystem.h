@@ -3,7 +3,8 @@
 #pragma once
 
 #include "Point.h"
-#include "LightSwitch.h"
+#include "GameBoard.h"
+#include "SignalGraph.h"
 #include "Torch.h"
 #include "Player.h"
 #include <vector>
@@ -23,18 +24,54 @@ private:
     bool isDarkRoom;
     int torchRadius;
 
+    // Light source as it was when the light map was built, with its cached field of view
+    struct Emitter {
+        Point pos;
+        int radius;
+        std::vector<BoardRowMask> field;  // Lit cells for rows pos.y - radius .. pos.y + radius
+
+        Emitter(const Point& p, int r) : pos(p), radius(r) {}
+        bool operator==(const Emitter& other) const { return pos == other.pos && radius == other.radius; }
+    };
+    std::vector<Emitter> emitters;
+
+    // Fog of war: cells that have been visible at some point (OR of every light map)
+    BoardRowMask exploredRows[GameConfig::GAME_HEIGHT];
+
+    // Wall layer the cached fields were cast against
+    BoardRowMask wallSnapshot[GameConfig::GAME_HEIGHT];
+
+    // Torch light map: bit x of row y set = cell lit by some torch
+    BoardRowMask litRows[GameConfig::GAME_HEIGHT];
+    bool lightMapDirty;
+
+    // Disc shapes: radius -> half width of the lit span for each row offset -r..r
+    std::vector<std::vector<int>> discSpans;
+
     // References (not owned)
-    const std::vector<std::unique_ptr<LightSwitch>>* lightSwitches;
+    const GameBoard* board;
+    const SignalGraph* signals;
+    int roomLightSignal;  // Consumer fed by the light switches
     const std::vector<std::unique_ptr<Torch>>* torches;
     const std::vector<DroppedTorch>* droppedTorches;
     const Player* player1;
     const Player* player2;
 
+    void collectEmitters(std::vector<Emitter>& out) const;
+    const std::vector<int>& getDiscSpans(int radius);
+    BoardRowMask spanMask(int x0, int x1) const;
+    bool isOpaque(int x, int y) const;
+    void castField(Emitter& emitter);
+    void scanRow(Emitter& emitter, int quadrant, int depth,
+                 int startNum, int startDen, int endNum, int endDen);
+    bool wallsChangedNear(const Emitter& emitter, const BoardRowMask* changed) const;
+
 public:
     LightingSystem();
 
     // Setup
-    void setLightSwitches(const std::vector<std::unique_ptr<LightSwitch>>* sw);
+    void setBoard(const GameBoard* b);
+    void setRoomLight(const SignalGraph* graph, int consumer);
     void setTorches(const std::vector<std::unique_ptr<Torch>>* t);
     void setDroppedTorches(const std::vector<DroppedTorch>* dt);
     void setPlayers(const Player* p1, const Player* p2);
@@ -45,7 +82,21 @@ public:
     void setTorchRadius(int radius);
     int getTorchRadius() const;
 
-    // Checks
+    // Rebuild the light map if a light source moved, appeared or went out, or a wall
+    // inside a torch's radius changed. Only those torches recast their field of view.
+    // Call once per frame before visibility queries; returns true if the map changed.
+    bool update();
+    void invalidate();
+    const BoardRowMask& getLitRow(int y) const;
+    BoardRowMask getVisibleRow(int y) const;  // isCellVisible for a whole row
+
+    // Fog of war (updated by update(), stored in save files)
+    const BoardRowMask& getExploredRow(int y) const;
+    void setExploredRow(int y, const BoardRowMask& row);
+    void clearExplored();
+    bool isCellRemembered(int x, int y) const;  // explored but not visible now
+
+    // Checks (bit tests against the light map)
     bool isRoomLit() const;
     bool isInTorchLight(int x, int y) const;
     bool isCellVisible(int x, int y) const;
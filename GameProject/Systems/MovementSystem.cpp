@@ -0,0 +1,203 @@
+// MovementSystem.cpp - Movement rules shared by every mover on a level
+// Movers act in insertion order over one occupancy grid, so the result is
+// deterministic and does not depend on how many movers there are.
+// AI usage: Spring momentum physics (AI written), cooperative pushing (AI assisted)
+
+#include "MovementSystem.h"
+#include "GameConfig.h"
+#include <algorithm>
+#include <cstdlib>
+
+MovementSystem::MovementSystem()
+    : board(nullptr), objects(nullptr), collision(nullptr),
+    occupancy(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, 0) {
+}
+
+// Dependency injection
+void MovementSystem::setBoard(GameBoard* b) { board = b; }
+void MovementSystem::setObjectManager(ObjectManager* obj) { objects = obj; }
+void MovementSystem::setCollisionSystem(CollisionSystem* col) { collision = col; }
+
+// Mover list
+void MovementSystem::clearMovers() {
+    movers.clear();
+    std::fill(occupancy.begin(), occupancy.end(), 0);
+}
+
+void MovementSystem::addMover(Player* player, int id) {
+    if (!player) return;
+    movers.push_back(Mover(player, id));
+    occupy(movers.back());
+}
+
+std::vector<Mover>& MovementSystem::getMovers() { return movers; }
+
+Mover* MovementSystem::moverAt(const Point& pos) {
+    int idx = cellIndex(pos);
+    if (idx < 0 || occupancy[idx] == 0) return nullptr;
+    return &movers[occupancy[idx] - 1];
+}
+
+void MovementSystem::setFinished(Mover& mover) {
+    vacate(mover);
+    mover.finished = true;
+}
+
+void MovementSystem::resetFinished() {
+    for (auto& mover : movers) mover.finished = false;
+    syncPositions();
+}
+
+bool MovementSystem::allFinished() const {
+    if (movers.empty()) return false;
+    for (const auto& mover : movers) {
+        if (!mover.finished) return false;
+    }
+    return true;
+}
+
+// Occupancy grid
+int MovementSystem::cellIndex(const Point& p) const {
+    if (!p.isInBounds()) return -1;
+    return p.getY() * GameConfig::GAME_WIDTH + p.getX();
+}
+
+void MovementSystem::occupy(const Mover& mover) {
+    if (mover.finished) return;
+    int idx = cellIndex(mover.player->getPosition());
+    if (idx >= 0) occupancy[idx] = static_cast<int>(&mover - movers.data()) + 1;
+}
+
+void MovementSystem::vacate(const Mover& mover) {
+    int idx = cellIndex(mover.player->getPosition());
+    if (idx >= 0 && occupancy[idx] == static_cast<int>(&mover - movers.data()) + 1) {
+        occupancy[idx] = 0;
+    }
+}
+
+void MovementSystem::syncPositions() {
+    std::fill(occupancy.begin(), occupancy.end(), 0);
+    for (const auto& mover : movers) occupy(mover);
+}
+
+// Collision against the level and against other active movers
+bool MovementSystem::isMoveBlocked(const Mover& mover, const Point& nextPos) {
+    if (collision && collision->checkMovementCollision(nextPos, nullptr)) return true;
+    Mover* other = moverAt(nextPos);
+    return other && other != &mover;
+}
+
+void MovementSystem::moveForward(Mover& mover, StepEvents& events) {
+    events.push(StepEvent(StepEventType::PlayerMoved, mover.id, mover.player->getPosition()));
+    vacate(mover);
+    mover.player->move();
+    occupy(mover);
+}
+
+// A mover helps if it stands next to the pusher or behind any pushed obstacle
+// and is flying, facing or recently moving in the push direction
+bool MovementSystem::isHelpingPush(const Mover& helper, const Mover& pusher,
+                                   const std::vector<Obstacle*>& chain, Direction dir) const {
+    if (&helper == &pusher || helper.finished) return false;
+
+    const Player& other = *helper.player;
+    Point otherPos = other.getPosition();
+    int dx = std::abs(pusher.player->getPosition().getX() - otherPos.getX());
+    int dy = std::abs(pusher.player->getPosition().getY() - otherPos.getY());
+    bool adjacentToPusher = (dx + dy == 1);
+    Point otherNextPos = otherPos.getNextPosition(dir);
+    bool adjacentToObstacle = false;
+    for (const Obstacle* obstacle : chain) {
+        if (obstacle->containsPoint(otherNextPos)) {
+            adjacentToObstacle = true;
+            break;
+        }
+    }
+    if (!adjacentToPusher && !adjacentToObstacle) return false;
+
+    bool flying = other.hasActiveSpringMomentum() && other.getSpringDirection() == dir;
+    bool facing = (other.getDirection() == dir);
+    bool recentlyMoved = (other.getLastMoveDirection() == dir &&
+                          other.getLastMoveAge() <= PUSH_GRACE_CYCLES);
+    return flying || facing || recentlyMoved;
+}
+
+int MovementSystem::getPushForce(const Mover& pusher, const std::vector<Obstacle*>& chain, Direction dir) const {
+    int force = pusher.player->getForce();
+    for (const auto& helper : movers) {
+        if (isHelpingPush(helper, pusher, chain, dir)) {
+            force += helper.player->getForce();
+        }
+    }
+    return force;
+}
+
+bool MovementSystem::tryPushObstacle(Mover& mover, Direction dir, StepEvents& events) {
+    if (!objects || !board) return false;
+
+    Point nextPos = mover.player->getPosition().getNextPosition(dir);
+    Obstacle* obstacle = objects->getObstacleAt(nextPos);
+    if (!obstacle) return false;
+
+    std::vector<Obstacle*> chain;
+    if (!objects->collectPushChain(*obstacle, dir, chain)) return false;
+
+    int required = 0;
+    for (const Obstacle* linked : chain) required += linked->getSize();
+    if (getPushForce(mover, chain, dir) < required) return false;
+
+    Obstacle::pushChain(chain, dir, board);
+    events.push(StepEvent(StepEventType::FullRedraw));
+    return true;
+}
+
+// AI-written: Spring flight - travel `speed` cells along the launch direction,
+// hand momentum to a mover in the way, push obstacles with combined force,
+// then allow one perpendicular steering step from the player's input
+void MovementSystem::updateSpringFlight(Mover& mover, StepEvents& events) {
+    if (!board) return;
+
+    Player& player = *mover.player;
+    Direction springDir = player.getSpringDirection();
+    Direction inputDir = player.getDirection();
+    int speed = player.getSpringSpeed();
+    int duration = speed * speed;
+
+    player.setDirection(springDir);
+    for (int i = 0; i < speed; i++) {
+        Point nextPos = player.getNextPosition();
+        if (!nextPos.isInBounds()) break;
+
+        char cell = board->getCell(nextPos);
+        if (cell == 'W') break;
+
+        // Transfer momentum on collision
+        Mover* other = moverAt(nextPos);
+        if (other && other != &mover) {
+            other->player->setSpringMomentum(springDir, speed, duration);
+            events.push(StepEvent(StepEventType::MomentumTransferred, mover.id, nextPos));
+            break;
+        }
+
+        if (objects && objects->getObstacleAt(nextPos)) {
+            if (!tryPushObstacle(mover, springDir, events)) break;
+        }
+
+        if (cell == '*' || cell == '|' || cell == '-') break;
+
+        moveForward(mover, events);
+    }
+
+    // Allow perpendicular steering while in spring momentum
+    if (isPerpendicularDirection(springDir, inputDir)) {
+        player.setDirection(inputDir);
+        Point nextPos = player.getNextPosition();
+
+        if (nextPos.isInBounds() && !isMoveBlocked(mover, nextPos)) {
+            char cell = board->getCell(nextPos);
+            if (cell != 'W' && cell != '*' && cell != '|' && cell != '-') {
+                moveForward(mover, events);
+            }
+        }
+    }
+}
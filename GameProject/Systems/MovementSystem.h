@@ -0,0 +1,76 @@
+// MovementSystem.h - Movement rules shared by every mover on a level
+// Spring flight, lateral steering, momentum transfer and cooperative obstacle pushing
+
+#pragma once
+
+#include "Player.h"
+#include "GameBoard.h"
+#include "ObjectManager.h"
+#include "CollisionSystem.h"
+#include "LevelStep.h"
+#include <vector>
+
+// One entity driven by the movement system (processed in insertion order)
+struct Mover {
+    Player* player;
+    int id;          // Player number used in events and recordings
+    bool finished;   // Crossed the exit door (no longer blocks or helps push)
+
+    Mover(Player* p, int moverId) : player(p), id(moverId), finished(false) {}
+};
+
+class MovementSystem {
+private:
+    GameBoard* board;
+    ObjectManager* objects;
+    CollisionSystem* collision;
+
+    std::vector<Mover> movers;
+
+    // Cell -> index + 1 of the active mover standing there (0 = empty)
+    std::vector<int> occupancy;
+
+    static const int PUSH_GRACE_CYCLES = 5;  // A recent move still counts as pushing
+
+    int cellIndex(const Point& p) const;
+    void occupy(const Mover& mover);
+    void vacate(const Mover& mover);
+    bool isHelpingPush(const Mover& helper, const Mover& pusher,
+                       const std::vector<Obstacle*>& chain, Direction dir) const;
+
+public:
+    MovementSystem();
+
+    // Setup
+    void setBoard(GameBoard* b);
+    void setObjectManager(ObjectManager* obj);
+    void setCollisionSystem(CollisionSystem* col);
+
+    // Movers
+    void clearMovers();
+    void addMover(Player* player, int id);
+    std::vector<Mover>& getMovers();
+    Mover* moverAt(const Point& pos);
+    void setFinished(Mover& mover);
+    void resetFinished();
+    bool allFinished() const;
+
+    // Rebuild occupancy from player positions (positions may be set from outside)
+    void syncPositions();
+
+    // Walls, closed gates, obstacles and other active movers block
+    bool isMoveBlocked(const Mover& mover, const Point& nextPos);
+
+    // Step one cell in the mover's current direction
+    void moveForward(Mover& mover, StepEvents& events);
+
+    // Pusher's force plus every mover helping in the same direction
+    int getPushForce(const Mover& pusher, const std::vector<Obstacle*>& chain, Direction dir) const;
+
+    // Force solver: push the chain of touching obstacles ahead of the mover
+    // if the combined force of all helping movers covers the chain's total size
+    bool tryPushObstacle(Mover& mover, Direction dir, StepEvents& events);
+
+    // Spring-launched movement for one cycle (multi-cell, may steer sideways)
+    void updateSpringFlight(Mover& mover, StepEvents& events);
+};
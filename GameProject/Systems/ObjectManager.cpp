@@ -1,16 +1,23 @@
 // ObjectManager.cpp - Central manager for all game objects
 // Manages walls, keys, doors, gates, switches, torches, riddles, bombs, obstacles, springs
-// AI usage: Flood-fill grouping (AI-assisted), explosion cleanup (AI-assisted)
+// AI usage: Spring wall detection (AI-assisted), explosion cleanup (AI-assisted)
 
 #include "ObjectManager.h"
+#include "GridComponents.h"
 #include <cstdlib>
+#include <algorithm>
 
 // Struct for player-dropped keys
 ObjectManager::DroppedKeyItem::DroppedKeyItem(int x, int y)
     : position(x, y), collected(false) {
 }
 
-ObjectManager::ObjectManager() : board(nullptr) {}
+ObjectManager::ObjectManager()
+    : gateCells(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, 0),
+    bombCells(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, 0),
+    objectCells(GameConfig::GAME_WIDTH * GameConfig::GAME_HEIGHT, 0),
+    lightLogic(SignalLogic::Or), roomLightSignal(-1), board(nullptr) {
+}
 
 void ObjectManager::setBoard(GameBoard* b) {
     board = b;
@@ -19,6 +26,7 @@ void ObjectManager::setBoard(GameBoard* b) {
 // Add single wall tile at position
 void ObjectManager::addWall(int x, int y) {
     walls.push_back(std::make_unique<Wall>(x, y));
+    indexCellObject(CellObject::Wall, (int)walls.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, GameConfig::CHAR_WALL);
     }
@@ -40,6 +48,7 @@ void ObjectManager::addVerticalWall(int x, int y, int length) {
 
 void ObjectManager::addKey(int x, int y) {
     keys.push_back(std::make_unique<Key>(x, y));
+    indexCellObject(CellObject::Key, (int)keys.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, GameConfig::CHAR_KEY);
     }
@@ -73,19 +82,58 @@ void ObjectManager::addVerticalDoor(int x, int y, int length, char doorNum, int
 
 void ObjectManager::addGate(int x, int y, int width, int height, char doorNum) {
     gates.push_back(Gate(x, y, width, height, doorNum));
+    indexGate((int)gates.size() - 1);
+}
+
+// Register a gate's outline cells and door char. Gates are indexed in order, so
+// appending to a cell's chain keeps it in gate order.
+void ObjectManager::indexGate(int gateIdx) {
+    const Gate& gate = gates[gateIdx];
+    auto mark = [&](int x, int y) {
+        if (x < 0 || x >= GameConfig::GAME_WIDTH || y < 0 || y >= GameConfig::GAME_HEIGHT) return;
+        int* link = &gateCells[y * GameConfig::GAME_WIDTH + x];
+        while (*link != 0) {
+            if (gateLinks[*link - 1].gate == gateIdx) return;  // Corner already marked
+            link = &gateLinks[*link - 1].next;
+        }
+        gateLinks.push_back(GateLink{ gateIdx, 0 });
+        *link = (int)gateLinks.size();
+    };
+    int right = gate.getX() + gate.getWidth() - 1;
+    int bottom = gate.getY() + gate.getHeight() - 1;
+    for (int x = gate.getX(); x <= right; x++) {
+        mark(x, gate.getY());
+        mark(x, bottom);
+    }
+    for (int y = gate.getY(); y <= bottom; y++) {
+        mark(gate.getX(), y);
+        mark(right, y);
+    }
+    gatesByDoor[gate.getDoorNum()].push_back(gateIdx);
+}
+
+void ObjectManager::rebuildGateIndex() {
+    std::fill(gateCells.begin(), gateCells.end(), 0);
+    gateLinks.clear();
+    gatesByDoor.clear();
+    for (int i = 0; i < (int)gates.size(); i++) {
+        indexGate(i);
+    }
 }
 
 // Add light switch with initial state
 void ObjectManager::addLightSwitch(int x, int y, bool startOn) {
     lightSwitches.push_back(std::make_unique<LightSwitch>(x, y, startOn));
+    indexCellObject(CellObject::LightSwitch, (int)lightSwitches.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, 'S');
     }
 }
 
 // Add gate-linked switch
-void ObjectManager::addSwitch(int x, int y, char linkedGate, bool startOn) {
-    switches.push_back(std::make_unique<Switch>(x, y, linkedGate, startOn));
+void ObjectManager::addSwitch(int x, int y, const std::string& linkedGates, bool startOn) {
+    switches.push_back(std::make_unique<Switch>(x, y, linkedGates, startOn));
+    indexCellObject(CellObject::Switch, (int)switches.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, startOn ? '/' : '\\');
     }
@@ -93,6 +141,7 @@ void ObjectManager::addSwitch(int x, int y, char linkedGate, bool startOn) {
 
 void ObjectManager::addTorch(int x, int y, int radius) {
     torches.push_back(std::make_unique<Torch>(x, y, radius));
+    indexCellObject(CellObject::Torch, (int)torches.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, GameConfig::CHAR_TORCH);
     }
@@ -101,6 +150,7 @@ void ObjectManager::addTorch(int x, int y, int radius) {
 void ObjectManager::addRiddle(int x, int y, const std::string& question,
     const std::vector<std::string>& options, char correctAnswer) {
     riddles.push_back(std::make_unique<Riddle>(x, y, question, options, correctAnswer));
+    indexCellObject(CellObject::Riddle, (int)riddles.size() - 1, Point(x, y));
     if (board) {
         board->setCell(x, y, '?');
     }
@@ -108,11 +158,54 @@ void ObjectManager::addRiddle(int x, int y, const std::string& question,
 
 void ObjectManager::addBomb(int x, int y) {
     bombs.push_back(std::make_unique<Bomb>(x, y));
+    bombNext.push_back(0);
+    indexBomb((int)bombs.size() - 1);
     if (board) {
         board->setCell(x, y, '@');
     }
 }
 
+// Link a live bomb into its cell's chain, keeping the chain in bomb order
+void ObjectManager::indexBomb(int bombIdx) {
+    const Bomb& bomb = *bombs[bombIdx];
+    if (!bomb.isActive() || !bomb.getPosition().isInBounds()) return;
+
+    int* link = &bombCells[bomb.getY() * GameConfig::GAME_WIDTH + bomb.getX()];
+    while (*link != 0 && *link - 1 < bombIdx) {
+        link = &bombNext[*link - 1];
+    }
+    if (*link == bombIdx + 1) return;
+    bombNext[bombIdx] = *link;
+    *link = bombIdx + 1;
+    liveBombCells.set(bomb.getPosition());
+}
+
+void ObjectManager::unindexBomb(int bombIdx) {
+    const Bomb& bomb = *bombs[bombIdx];
+    if (!bomb.getPosition().isInBounds()) return;
+
+    int cell = bomb.getY() * GameConfig::GAME_WIDTH + bomb.getX();
+    int* link = &bombCells[cell];
+    while (*link != 0) {
+        if (*link == bombIdx + 1) {
+            *link = bombNext[bombIdx];
+            bombNext[bombIdx] = 0;
+            if (bombCells[cell] == 0) liveBombCells.rows[bomb.getY()].reset(bomb.getX());
+            return;
+        }
+        link = &bombNext[*link - 1];
+    }
+}
+
+void ObjectManager::rebuildBombIndex() {
+    std::fill(bombCells.begin(), bombCells.end(), 0);
+    std::fill(bombNext.begin(), bombNext.end(), 0);
+    liveBombCells = BoardMask();
+    for (int i = 0; i < (int)bombs.size(); i++) {
+        indexBomb(i);
+    }
+}
+
 // Queue obstacle cell for grouping in finalizeObstacles
 void ObjectManager::addObstacleCell(int x, int y) {
     pendingObstacleCells.push_back(Point(x, y));
@@ -129,78 +222,31 @@ void ObjectManager::addSpringCell(int x, int y) {
     }
 }
 
-// AI-assisted: Group adjacent obstacle cells using flood-fill algorithm
-// Connects orthogonally adjacent '*' cells into single pushable obstacles
+// Group orthogonally adjacent '*' cells into single pushable obstacles
+// (one union-find pass over the grid, see GridComponents)
 void ObjectManager::finalizeObstacles() {
-    std::vector<bool> used(pendingObstacleCells.size(), false);
-    
-    for (size_t i = 0; i < pendingObstacleCells.size(); i++) {
-        if (used[i]) continue;
-        
-        auto obstacle = std::make_unique<Obstacle>(
-            pendingObstacleCells[i].getX(), 
-            pendingObstacleCells[i].getY()
-        );
-        used[i] = true;
-        
-        // Flood fill to find connected cells (no diagonals)
-        std::vector<size_t> toCheck;
-        toCheck.push_back(i);
-        
-        while (!toCheck.empty()) {
-            size_t current = toCheck.back();
-            toCheck.pop_back();
-            
-            Point currentPos = pendingObstacleCells[current];
-            
-            for (size_t j = 0; j < pendingObstacleCells.size(); j++) {
-                if (used[j]) continue;
-                
-                Point otherPos = pendingObstacleCells[j];
-                int dx = std::abs(currentPos.getX() - otherPos.getX());
-                int dy = std::abs(currentPos.getY() - otherPos.getY());
-                
-                // Adjacent means sharing an edge
-                if ((dx == 1 && dy == 0) || (dx == 0 && dy == 1)) {
-                    obstacle->addBlock(otherPos);
-                    used[j] = true;
-                    toCheck.push_back(j);
-                }
-            }
+    GridComponents grouping;
+    for (const auto& cells : grouping.group(pendingObstacleCells)) {
+        auto obstacle = std::make_unique<Obstacle>();
+        for (const auto& cell : cells) {
+            obstacle->addBlock(cell);
         }
-        
         obstacle->saveOriginalPositions();
         obstacles.push_back(std::move(obstacle));
     }
-    
+
     pendingObstacleCells.clear();
 }
 
 // AI-assisted: Group spring cells and detect wall attachment for release direction
-// Determines horizontal/vertical orientation and which end has the wall
+// Each connected run of '#' is one spring; determines horizontal/vertical
+// orientation and which end has the wall
 void ObjectManager::finalizeSprings() {
-    std::vector<bool> used(pendingSpringCells.size(), false);
-    
-    for (size_t i = 0; i < pendingSpringCells.size(); i++) {
-        if (used[i]) continue;
-        
+    GridComponents grouping;
+    for (const auto& cells : grouping.group(pendingSpringCells)) {
         auto spring = std::make_unique<Spring>();
-        spring->addBlock(pendingSpringCells[i].getX(), pendingSpringCells[i].getY());
-        used[i] = true;
-        
-        // Group cells in same row or column
-        Point startPos = pendingSpringCells[i];
-        
-        for (size_t j = 0; j < pendingSpringCells.size(); j++) {
-            if (used[j]) continue;
-            
-            Point otherPos = pendingSpringCells[j];
-            
-            if (startPos.getX() == otherPos.getX() || 
-                startPos.getY() == otherPos.getY()) {
-                spring->addBlock(otherPos);
-                used[j] = true;
-            }
+        for (const auto& cell : cells) {
+            spring->addBlock(cell);
         }
         
         // Figure out which end has the wall and set release direction
@@ -257,6 +303,9 @@ void ObjectManager::finalizeSprings() {
         
         spring->finalize();
         springs.push_back(std::move(spring));
+        for (const Point& block : springs.back()->getBlocks()) {
+            indexCellObject(CellObject::Spring, (int)springs.size() - 1, block);
+        }
     }
     
     pendingSpringCells.clear();
@@ -265,6 +314,7 @@ void ObjectManager::finalizeSprings() {
 // Create dropped key at player position
 void ObjectManager::dropKey(const Point& pos) {
     droppedKeys.push_back(DroppedKeyItem(pos.getX(), pos.getY()));
+    indexCellObject(CellObject::DroppedKey, (int)droppedKeys.size() - 1, pos);
     if (board) {
         board->setCell(pos, GameConfig::CHAR_KEY);
     }
@@ -273,6 +323,7 @@ void ObjectManager::dropKey(const Point& pos) {
 // Create dropped torch at player position
 void ObjectManager::dropTorch(const Point& pos, int radius) {
     droppedTorches.push_back(DroppedTorch(pos.getX(), pos.getY(), radius));
+    indexCellObject(CellObject::DroppedTorch, (int)droppedTorches.size() - 1, pos);
     if (board) {
         board->setCell(pos, GameConfig::CHAR_TORCH);
     }
@@ -333,38 +384,101 @@ Torch* ObjectManager::getTorchAt(const Point& p) {
     return nullptr;
 }
 
+// First closed gate whose bars cover the cell
 Gate* ObjectManager::getGateAt(const Point& p) {
-    for (auto& gate : gates) {
-        if (!gate.getIsOpen() && gate.isOnGateBar(p)) {
-            return &gate;
-        }
+    if (!p.isInBounds()) return nullptr;
+    for (int link = gateCells[p.getY() * GameConfig::GAME_WIDTH + p.getX()]; link != 0;
+         link = gateLinks[link - 1].next) {
+        Gate& gate = gates[gateLinks[link - 1].gate];
+        if (gate.isOnGateBar(p)) return &gate;
     }
     return nullptr;
 }
 
+// First gate guarding the door
 Gate* ObjectManager::getGateByDoorNum(char doorNum) {
-    for (auto& gate : gates) {
-        if (gate.getDoorNum() == doorNum) {
-            return &gate;
-        }
+    auto it = gatesByDoor.find(doorNum);
+    if (it == gatesByDoor.end() || it->second.empty()) return nullptr;
+    return &gates[it->second.front()];
+}
+
+// Every gate guarding the door (several outlines may share one door char)
+std::vector<Gate*> ObjectManager::getGatesByDoorNum(char doorNum) {
+    std::vector<Gate*> result;
+    auto it = gatesByDoor.find(doorNum);
+    if (it == gatesByDoor.end()) return result;
+    for (int idx : it->second) {
+        result.push_back(&gates[idx]);
     }
-    return nullptr;
+    return result;
 }
 
-// Check if all switches linked to gate are in ON state
-bool ObjectManager::areAllSwitchesOnForGate(char doorNum) const {
-    bool hasSwitch = false;
-    for (const auto& sw : switches) {
-        if (sw->isActive() && sw->getLinkedGate() == doorNum) {
-            hasSwitch = true;
-            if (!sw->getIsOn()) {
-                return false;
+// Gate logic defaults to AND (all linked switches ON), room light to OR (any switch ON)
+void ObjectManager::setGateLogic(char doorNum, SignalLogic logic) {
+    gateLogic[doorNum] = logic;
+}
+
+void ObjectManager::setLightLogic(SignalLogic logic) {
+    lightLogic = logic;
+}
+
+// Compile switches into inputs and gate doors / room light into consumers
+void ObjectManager::buildSignalGraph() {
+    signals.clear();
+    gateSignals.clear();
+
+    roomLightSignal = signals.addConsumer(lightLogic);
+    for (auto& sw : lightSwitches) {
+        int input = signals.addInput(sw->getIsOn());
+        signals.setInput(input, sw->isActive(), sw->getIsOn());
+        signals.connect(input, roomLightSignal);
+        sw->setSignalInput(input);
+    }
+
+    for (auto& sw : switches) {
+        int input = signals.addInput(sw->getIsOn());
+        signals.setInput(input, sw->isActive(), sw->getIsOn());
+        for (char doorNum : sw->getLinkedGates()) {
+            auto it = gateSignals.find(doorNum);
+            if (it == gateSignals.end()) {
+                auto logic = gateLogic.find(doorNum);
+                int node = signals.addConsumer(logic != gateLogic.end() ? logic->second : SignalLogic::And);
+                it = gateSignals.emplace(doorNum, node).first;
             }
+            signals.connect(input, it->second);
         }
+        sw->setSignalInput(input);
+    }
+}
+
+void ObjectManager::syncSignalInputs() {
+    for (const auto& sw : lightSwitches) {
+        if (sw->getSignalInput() >= 0) signals.setInput(sw->getSignalInput(), sw->isActive(), sw->getIsOn());
+    }
+    for (const auto& sw : switches) {
+        if (sw->getSignalInput() >= 0) signals.setInput(sw->getSignalInput(), sw->isActive(), sw->getIsOn());
     }
-    return hasSwitch;
 }
 
+void ObjectManager::toggleSwitch(Switch& sw) {
+    sw.toggle();
+    if (sw.getSignalInput() >= 0) signals.setInput(sw.getSignalInput(), sw.isActive(), sw.getIsOn());
+}
+
+void ObjectManager::toggleLightSwitch(LightSwitch& sw) {
+    sw.toggle();
+    if (sw.getSignalInput() >= 0) signals.setInput(sw.getSignalInput(), sw.isActive(), sw.getIsOn());
+}
+
+// Linked switches satisfy the gate's logic (false if no switch is wired to it)
+bool ObjectManager::isGateSignalOn(char doorNum) const {
+    auto it = gateSignals.find(doorNum);
+    return it != gateSignals.end() && signals.isSatisfied(it->second);
+}
+
+const SignalGraph* ObjectManager::getSignals() const { return &signals; }
+int ObjectManager::getRoomLightSignal() const { return roomLightSignal; }
+
 ObjectManager::DroppedKeyItem* ObjectManager::getDroppedKeyAt(const Point& p) {
     for (auto& dk : droppedKeys) {
         if (!dk.collected && dk.position == p) {
@@ -393,14 +507,101 @@ Riddle* ObjectManager::getRiddleAt(const Point& p) {
 }
 
 Bomb* ObjectManager::getBombAt(const Point& p) {
-    for (auto& bomb : bombs) {
-        if (bomb->isIdle() && bomb->collidesWith(p)) {
-            return bomb.get();
+    for (int i = firstBombAt(p); i >= 0; i = nextBombInCell(i)) {
+        if (bombs[i]->isIdle()) return bombs[i].get();
+    }
+    return nullptr;
+}
+
+int ObjectManager::firstBombAt(const Point& p) const {
+    if (!p.isInBounds()) return -1;
+    return bombCells[p.getY() * GameConfig::GAME_WIDTH + p.getX()] - 1;
+}
+
+int ObjectManager::nextBombInCell(int bombIdx) const {
+    return bombNext[bombIdx] - 1;
+}
+
+bool ObjectManager::hasLiveBombAt(const Point& p) const {
+    return firstBombAt(p) >= 0;
+}
+
+const BoardMask& ObjectManager::getLiveBombCells() const {
+    return liveBombCells;
+}
+
+std::vector<int> ObjectManager::getDoorTargets() const {
+    std::vector<int> targets;
+    for (const auto& door : doors) {
+        int target = door->getTargetScreen();
+        if (std::find(targets.begin(), targets.end(), target) == targets.end()) targets.push_back(target);
+    }
+    return targets;
+}
+
+bool ObjectManager::hasTickingBomb() const {
+    for (const auto& bomb : bombs) {
+        if (bomb->isActiveCountdown()) return true;
+    }
+    return false;
+}
+
+// Register a destructible object on its cell
+void ObjectManager::indexCellObject(CellObject kind, int index, const Point& p) {
+    if (!p.isInBounds()) return;
+    int& head = objectCells[p.getY() * GameConfig::GAME_WIDTH + p.getX()];
+    cellEntries.push_back(CellEntry{ kind, index, head });
+    head = (int)cellEntries.size();
+}
+
+void ObjectManager::rebuildCellIndex() {
+    std::fill(objectCells.begin(), objectCells.end(), 0);
+    cellEntries.clear();
+    for (int i = 0; i < (int)walls.size(); i++) indexCellObject(CellObject::Wall, i, walls[i]->getPosition());
+    for (int i = 0; i < (int)lightSwitches.size(); i++) indexCellObject(CellObject::LightSwitch, i, lightSwitches[i]->getPosition());
+    for (int i = 0; i < (int)switches.size(); i++) indexCellObject(CellObject::Switch, i, switches[i]->getPosition());
+    for (int i = 0; i < (int)torches.size(); i++) indexCellObject(CellObject::Torch, i, torches[i]->getPosition());
+    for (int i = 0; i < (int)keys.size(); i++) indexCellObject(CellObject::Key, i, keys[i]->getPosition());
+    for (int i = 0; i < (int)riddles.size(); i++) indexCellObject(CellObject::Riddle, i, riddles[i]->getPosition());
+    for (int i = 0; i < (int)springs.size(); i++) {
+        for (const Point& block : springs[i]->getBlocks()) indexCellObject(CellObject::Spring, i, block);
+    }
+    for (int i = 0; i < (int)droppedKeys.size(); i++) indexCellObject(CellObject::DroppedKey, i, droppedKeys[i].position);
+    for (int i = 0; i < (int)droppedTorches.size(); i++) indexCellObject(CellObject::DroppedTorch, i, droppedTorches[i].position);
+}
+
+void ObjectManager::clearRiddles() {
+    riddles.clear();
+    rebuildCellIndex();
+}
+
+// Picked-up bombs leave the board until planted again
+void ObjectManager::collectBomb(Bomb& bomb) {
+    for (int i = firstBombAt(bomb.getPosition()); i >= 0; i = nextBombInCell(i)) {
+        if (bombs[i].get() == &bomb) {
+            unindexBomb(i);
+            break;
+        }
+    }
+    bomb.collect();
+}
+
+// Plant the bomb a player carries and start its countdown
+Bomb* ObjectManager::plantCollectedBomb(const Point& pos) {
+    for (int i = 0; i < (int)bombs.size(); i++) {
+        if (bombs[i]->isCollected()) {
+            bombs[i]->activate(pos);
+            indexBomb(i);
+            return bombs[i].get();
         }
     }
     return nullptr;
 }
 
+void ObjectManager::removeExplodedBomb(int bombIdx) {
+    unindexBomb(bombIdx);
+}
+
 Obstacle* ObjectManager::getObstacleAt(const Point& p) {
     for (auto& obstacle : obstacles) {
         if (obstacle->isActive() && obstacle->containsPoint(p)) {
@@ -410,6 +611,43 @@ Obstacle* ObjectManager::getObstacleAt(const Point& p) {
     return nullptr;
 }
 
+// Walk the push front of each obstacle in the chain: empty cells are fine, cells of
+// other obstacles add those obstacles to the chain, anything else blocks the push
+bool ObjectManager::collectPushChain(Obstacle& first, Direction dir, std::vector<Obstacle*>& chain) {
+    chain.clear();
+    if (!board) return false;
+    chain.push_back(&first);
+
+    for (size_t i = 0; i < chain.size(); i++) {
+        Obstacle* current = chain[i];
+        if (!current->canMoveWithinBoard(dir)) return false;
+
+        int firstY, lastY;
+        current->getTargetRows(dir, firstY, lastY);
+        for (int y = firstY; y <= lastY; y++) {
+            BoardRowMask hit = current->getFrontRow(y, dir) & board->getOccupiedRow(y);
+            if (hit.none()) continue;
+
+            BoardRowMask obstacleHit = hit & board->getObstacleRow(y);
+            if (obstacleHit != hit) return false;  // wall, gate, item...
+
+            // Find the obstacles owning the touched blocks
+            BoardRowMask covered;
+            for (auto& other : obstacles) {
+                if (!other->isActive() || other.get() == current) continue;
+                BoardRowMask overlap = other->getRow(y) & obstacleHit;
+                if (overlap.none()) continue;
+                covered |= overlap;
+                if (std::find(chain.begin(), chain.end(), other.get()) == chain.end()) {
+                    chain.push_back(other.get());
+                }
+            }
+            if (covered != obstacleHit) return false;  // stray block with no owner
+        }
+    }
+    return true;
+}
+
 Spring* ObjectManager::getSpringAt(const Point& p) {
     for (auto& spring : springs) {
         if (spring->isActive() && spring->containsPoint(p)) {
@@ -546,10 +784,13 @@ void ObjectManager::reset() {
     for (auto& gate : gates) { gate.reset(); }
     for (auto& riddle : riddles) { riddle->activate(); }
     for (auto& bomb : bombs) { bomb->resetBomb(); }
+    rebuildBombIndex();
     for (auto& obstacle : obstacles) { obstacle->reset(); }
     for (auto& spring : springs) { spring->resetCompression(); }
     droppedKeys.clear();
     droppedTorches.clear();
+    rebuildCellIndex();
+    syncSignalInputs();
 }
 
 // Lighting system accessors
@@ -565,111 +806,139 @@ const std::vector<DroppedTorch>* ObjectManager::getDroppedTorches() const {
     return &droppedTorches;
 }
 
-// AI-assisted: Destroy objects at position (explosion cleanup)
-// Removes walls, switches, torches, keys, riddles, bombs, obstacles, springs, and gates
-// Doors are protected from destruction as they are level exits
-bool ObjectManager::destroyAt(const Point& p) {
+// AI-assisted: Destroy objects in an area (explosion cleanup)
+// Removes walls, switches, torches, keys, riddles, bombs, obstacles, springs, and gates.
+// Cells are resolved through the cell, bomb and gate indexes; obstacles (which move)
+// are matched against the area once each. Doors are protected as they are level exits.
+bool ObjectManager::destroyArea(const BoardMask& area, const BoardMask& preserve) {
+    BoardMask hit = area - preserve;
     bool destroyed = false;
 
-    auto clearCell = [&](const Point& pt) {
-        if (board) board->setCell(pt, GameConfig::CHAR_EMPTY);
-    };
-
-    // Walls can be destroyed
-    for (auto& wall : walls) {
-        if (wall->isActive() && wall->collidesWith(p)) {
-            wall->deactivate();
-            clearCell(p);
-            destroyed = true;
+    for (int y = 0; y < GameConfig::GAME_HEIGHT; y++) {
+        if (hit.rows[y].none()) continue;
+        for (int x = 0; x < GameConfig::GAME_WIDTH; x++) {
+            if (hit.rows[y][x] && destroyCell(Point(x, y))) destroyed = true;
         }
     }
 
-    // Doors are protected from explosions (level exits)
-
-    for (auto& sw : lightSwitches) {
-        if (sw->isActive() && sw->collidesWith(p)) {
-            sw->deactivate();
-            clearCell(p);
+    // Destroying any part destroys the whole obstacle
+    for (auto& obs : obstacles) {
+        if (obs->isActive() && obs->intersects(hit)) {
+            obs->clearFromBoard(board);
+            obs->deactivate();
             destroyed = true;
         }
     }
 
-    for (auto& sw : switches) {
-        if (sw->isActive() && sw->collidesWith(p)) {
-            sw->deactivate();
-            clearCell(p);
-            destroyed = true;
-        }
-    }
+    return destroyed;
+}
 
-    for (auto& torch : torches) {
-        if (torch->isActive() && torch->collidesWith(p)) {
-            torch->deactivate();
-            clearCell(p);
-            destroyed = true;
-        }
-    }
+bool ObjectManager::destroyAt(const Point& p) {
+    BoardMask cell;
+    cell.set(p);
+    return destroyArea(cell, BoardMask());
+}
 
-    for (auto& key : keys) {
-        if (key->isActive() && key->collidesWith(p)) {
-            key->deactivate();
-            clearCell(p);
-            destroyed = true;
-        }
-    }
+// Everything indexed on one cell (obstacles are handled by destroyArea)
+bool ObjectManager::destroyCell(const Point& p) {
+    bool destroyed = false;
 
-    for (auto& riddle : riddles) {
-        if (riddle->isActive() && riddle->collidesWith(p)) {
-            riddle->deactivate();
-            clearCell(p);
-            destroyed = true;
-        }
-    }
+    auto clearCell = [&](const Point& pt) {
+        if (board) board->setCell(pt, GameConfig::CHAR_EMPTY);
+    };
+    auto destroyObject = [&](GameObject& obj) {
+        if (!obj.isActive()) return false;
+        obj.deactivate();
+        clearCell(p);
+        return true;
+    };
 
-    for (auto& bomb : bombs) {
-        if (bomb->isIdle() && bomb->collidesWith(p)) {
-            bomb->deactivate();
-            clearCell(p);
-            destroyed = true;
+    // Doors are not indexed: they are protected from explosions (level exits)
+    for (int e = objectCells[p.getY() * GameConfig::GAME_WIDTH + p.getX()]; e != 0; e = cellEntries[e - 1].next) {
+        const CellEntry& entry = cellEntries[e - 1];
+        switch (entry.kind) {
+        case CellObject::Wall:
+            if (destroyObject(*walls[entry.index])) destroyed = true;
+            break;
+        case CellObject::LightSwitch: {
+            LightSwitch& sw = *lightSwitches[entry.index];
+            if (destroyObject(sw)) {
+                if (sw.getSignalInput() >= 0) signals.setInput(sw.getSignalInput(), false, sw.getIsOn());
+                destroyed = true;
+            }
+            break;
         }
-    }
-
-    // Destroying any part destroys the whole obstacle
-    for (auto& obs : obstacles) {
-        if (obs->isActive() && obs->containsPoint(p)) {
-            obs->clearFromBoard(board);
-            obs->deactivate();
-            destroyed = true;
+        case CellObject::Switch: {
+            Switch& sw = *switches[entry.index];
+            if (destroyObject(sw)) {
+                if (sw.getSignalInput() >= 0) signals.setInput(sw.getSignalInput(), false, sw.getIsOn());
+                destroyed = true;
+            }
+            break;
+        }
+        case CellObject::Torch:
+            if (destroyObject(*torches[entry.index])) destroyed = true;
+            break;
+        case CellObject::Key:
+            if (destroyObject(*keys[entry.index])) destroyed = true;
+            break;
+        case CellObject::Riddle:
+            if (destroyObject(*riddles[entry.index])) destroyed = true;
+            break;
+        case CellObject::Spring: {
+            Spring& spring = *springs[entry.index];
+            if (spring.isActive()) {
+                spring.deactivate();
+                destroyed = true;
+            }
+            break;
+        }
+        case CellObject::DroppedKey: {
+            DroppedKeyItem& dk = droppedKeys[entry.index];
+            if (!dk.collected) {
+                dk.collected = true;
+                clearCell(p);
+                destroyed = true;
+            }
+            break;
+        }
+        case CellObject::DroppedTorch: {
+            DroppedTorch& dt = droppedTorches[entry.index];
+            if (!dt.collected) {
+                dt.collected = true;
+                clearCell(p);
+                destroyed = true;
+            }
+            break;
         }
-    }
-
-    for (auto& spring : springs) {
-        if (spring->isActive() && spring->containsPoint(p)) {
-            spring->deactivate();
-            destroyed = true;
         }
     }
 
-    for (auto& dk : droppedKeys) {
-        if (!dk.collected && dk.position == p) {
-            dk.collected = true;
+    for (int i = firstBombAt(p); i >= 0; ) {
+        int next = nextBombInCell(i);
+        if (bombs[i]->isIdle()) {
+            unindexBomb(i);
+            bombs[i]->deactivate();
             clearCell(p);
             destroyed = true;
         }
+        i = next;
     }
 
-    for (auto& dt : droppedTorches) {
-        if (!dt.collected && dt.position == p) {
-            dt.collected = true;
-            clearCell(p);
-            destroyed = true;
+    // Hit a closed gate's bar or any gate's corner removes the whole thing. Only the
+    // gates chained on this cell are tested; they are in gate order, so erasing the
+    // hit ones from the last back keeps the earlier indices valid.
+    int cellLink = gateCells[p.getY() * GameConfig::GAME_WIDTH + p.getX()];
+    if (cellLink != 0) {
+        std::vector<int> hitGates;
+        for (int link = cellLink; link != 0; link = gateLinks[link - 1].next) {
+            int g = gateLinks[link - 1].gate;
+            if (gates[g].isOnGateBar(p) || gates[g].isAtCorner(p.getX(), p.getY())) {
+                hitGates.push_back(g);
+            }
         }
-    }
-
-    // Hit any part of gate removes the whole thing
-    for (auto it = gates.begin(); it != gates.end(); ) {
-        bool hit = it->isOnGateBar(p) || it->isAtCorner(p.getX(), p.getY());
-        if (hit) {
+        for (auto g = hitGates.rbegin(); g != hitGates.rend(); ++g) {
+            auto it = gates.begin() + *g;
             if (board) {
                 it->clearBarsFromBoard(board->getRawBoard());
                 board->setCell(Point(it->getX(), it->getY()), GameConfig::CHAR_EMPTY);
@@ -677,10 +946,11 @@ bool ObjectManager::destroyAt(const Point& p) {
                 board->setCell(Point(it->getX(), it->getY() + it->getHeight() - 1), GameConfig::CHAR_EMPTY);
                 board->setCell(Point(it->getX() + it->getWidth() - 1, it->getY() + it->getHeight() - 1), GameConfig::CHAR_EMPTY);
             }
-            it = gates.erase(it);
+            gates.erase(it);
+        }
+        if (!hitGates.empty()) {
+            rebuildGateIndex();
             destroyed = true;
-        } else {
-            ++it;
         }
     }
 
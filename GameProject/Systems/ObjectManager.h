@@ -16,9 +16,11 @@
 #include "Spring.h"
 #include "GameBoard.h"
 #include "LightingSystem.h"
+#include "SignalGraph.h"
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 class ObjectManager {
 public:
@@ -52,9 +54,52 @@ private:
     std::vector<Point> pendingObstacleCells;
     std::vector<Point> pendingSpringCells;
 
+    // Gate lookup tables (rebuilt when a gate is removed); gates whose outlines share
+    // a cell are chained on it in gate order
+    struct GateLink {
+        int gate;  // Gate index
+        int next;  // Index + 1 of the next link on the same cell
+    };
+    std::vector<int> gateCells;                           // Cell -> index + 1 of its first gate link
+    std::vector<GateLink> gateLinks;                      // One per gate outline cell
+    std::unordered_map<char, std::vector<int>> gatesByDoor;  // Door char -> gate indices
+
+    // Bomb lookup: live (active) bombs per cell, chained in index order
+    std::vector<int> bombCells;  // Cell -> index + 1 of the first live bomb on it
+    std::vector<int> bombNext;   // Bomb index -> index + 1 of the next live bomb on its cell
+    BoardMask liveBombCells;     // Cells with at least one live bomb
+
+    // Destructible objects per cell (obstacles move and are matched against the mask instead)
+    enum class CellObject : unsigned char {
+        Wall, LightSwitch, Switch, Torch, Key, Riddle, Spring, DroppedKey, DroppedTorch
+    };
+    struct CellEntry {
+        CellObject kind;
+        int index;  // Into the vector of that kind
+        int next;   // Entry index + 1 of the next object on the cell
+    };
+    std::vector<int> objectCells;         // Cell -> entry index + 1 of the first object on it
+    std::vector<CellEntry> cellEntries;
+
+    // Switch wiring (compiled by buildSignalGraph)
+    SignalGraph signals;
+    std::unordered_map<char, int> gateSignals;          // Door char -> consumer node
+    std::unordered_map<char, SignalLogic> gateLogic;    // Door char -> logic from metadata
+    SignalLogic lightLogic;
+    int roomLightSignal;
+
     // Board reference (not owned)
     GameBoard* board;
 
+    void indexGate(int gateIdx);
+    void rebuildGateIndex();
+    void indexBomb(int bombIdx);
+    void unindexBomb(int bombIdx);
+    void rebuildBombIndex();
+    void indexCellObject(CellObject kind, int index, const Point& p);
+    void rebuildCellIndex();
+    bool destroyCell(const Point& p);
+
 public:
     ObjectManager();
 
@@ -72,7 +117,7 @@ public:
     void addVerticalDoor(int x, int y, int length, char doorNum, int targetScreen = -1);
     void addGate(int x, int y, int width, int height, char doorNum);
     void addLightSwitch(int x, int y, bool startOn = false);
-    void addSwitch(int x, int y, char linkedGate, bool startOn = false);
+    void addSwitch(int x, int y, const std::string& linkedGates, bool startOn = false);
     void addTorch(int x, int y, int radius = 5);
     void addRiddle(int x, int y, const std::string& question,
         const std::vector<std::string>& options, char correctAnswer);
@@ -97,6 +142,7 @@ public:
     Torch* getTorchAt(const Point& p);
     Gate* getGateAt(const Point& p);
     Gate* getGateByDoorNum(char doorNum);
+    std::vector<Gate*> getGatesByDoorNum(char doorNum);
     DroppedKeyItem* getDroppedKeyAt(const Point& p);
     DroppedTorch* getDroppedTorchAt(const Point& p);
     Riddle* getRiddleAt(const Point& p);
@@ -104,13 +150,37 @@ public:
     Obstacle* getObstacleAt(const Point& p);
     Spring* getSpringAt(const Point& p);
     
+    // Bomb lifecycle (keeps the bomb lookup in step with bomb state)
+    void collectBomb(Bomb& bomb);
+    Bomb* plantCollectedBomb(const Point& pos);
+    void removeExplodedBomb(int bombIdx);
+    int firstBombAt(const Point& p) const;      // Live bomb index, -1 if none
+    int nextBombInCell(int bombIdx) const;      // Next live bomb on the same cell, -1 if none
+    bool hasLiveBombAt(const Point& p) const;
+    const BoardMask& getLiveBombCells() const;
+    bool hasTickingBomb() const;
+
+    // Distinct door target screens (-1 = the next screen in order)
+    std::vector<int> getDoorTargets() const;
+    
     // Get all objects (for updates)
     std::vector<std::unique_ptr<Bomb>>& getBombs();
     std::vector<std::unique_ptr<Obstacle>>& getObstacles();
     std::vector<std::unique_ptr<Spring>>& getSprings();
 
-    // Switch-gate logic
-    bool areAllSwitchesOnForGate(char doorNum) const;
+    // Obstacles that move together when `first` is pushed in dir (false if the chain is blocked)
+    bool collectPushChain(Obstacle& first, Direction dir, std::vector<Obstacle*>& chain);
+
+    // Switch wiring: build once all switches and gates exist, then flip inputs in O(fan-out)
+    void setGateLogic(char doorNum, SignalLogic logic);
+    void setLightLogic(SignalLogic logic);
+    void buildSignalGraph();
+    void syncSignalInputs();  // Re-read every switch (after reset)
+    void toggleSwitch(Switch& sw);
+    void toggleLightSwitch(LightSwitch& sw);
+    bool isGateSignalOn(char doorNum) const;
+    const SignalGraph* getSignals() const;
+    int getRoomLightSignal() const;
 
     // Check for keys in room
     bool hasKeysInRoom() const;
@@ -128,8 +198,9 @@ public:
 
     // Riddle management
     std::vector<std::unique_ptr<Riddle>>& getRiddles() { return riddles; }
-    void clearRiddles() { riddles.clear(); }
+    void clearRiddles();
 
-    // Destruction helper (used by bomb shrapnel)
+    // Destruction (explosions): every object on a cell in area and not in preserve
+    bool destroyArea(const BoardMask& area, const BoardMask& preserve);
     bool destroyAt(const Point& p);
 };
\ No newline at end of file
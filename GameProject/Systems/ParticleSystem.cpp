@@ -0,0 +1,100 @@
+// ParticleSystem.cpp - Pooled structure-of-arrays particles with per-emitter hit masks
+
+#include "ParticleSystem.h"
+
+ParticleSystem::ParticleSystem() : count(0), freeCount(0) {
+    reserve(DEFAULT_EMITTERS, DEFAULT_PARTICLES / DEFAULT_EMITTERS);
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+    int emitterCount = (int)emitters.size();
+    freeCount = emitterCount;
+    for (int e = 0; e < emitterCount; e++) {
+        // Lowest slot on top so emitters are handed out in order
+        freeEmitters[e] = static_cast<unsigned short>(emitterCount - 1 - e);
+    }
+}
+
+void ParticleSystem::reserve(int emitterCount, int particlesPerEmitter) {
+    if (emitterCount > (int)emitters.size()) {
+        emitters.resize(emitterCount);
+        freeEmitters.resize(emitterCount);
+    }
+    size_t particles = (size_t)emitterCount * particlesPerEmitter;
+    if (particles > posX.size()) {
+        posX.resize(particles);
+        posY.resize(particles);
+        prevX.resize(particles);
+        prevY.resize(particles);
+        velX.resize(particles);
+        velY.resize(particles);
+        symbols.resize(particles);
+        stepsLeft.resize(particles);
+        emitterOf.resize(particles);
+        alive.resize(particles);
+    }
+    clear();
+}
+
+int ParticleSystem::addEmitter(const Point& origin, Color color, int particleCount) {
+    if (freeCount == 0 || count + particleCount > (int)posX.size()) return -1;
+    int e = freeEmitters[--freeCount];
+    emitters[e].origin = origin;
+    emitters[e].color = color;
+    emitters[e].liveParticles = 0;
+    emitters[e].hitMask = 0;
+    return e;
+}
+
+void ParticleSystem::spawn(int emitter, int dx, int dy, char symbol, int steps) {
+    if (count >= (int)posX.size()) return;
+    const Point& origin = emitters[emitter].origin;
+    int i = count++;
+    posX[i] = prevX[i] = static_cast<short>(origin.getX());
+    posY[i] = prevY[i] = static_cast<short>(origin.getY());
+    velX[i] = static_cast<signed char>(dx);
+    velY[i] = static_cast<signed char>(dy);
+    symbols[i] = symbol;
+    stepsLeft[i] = static_cast<short>(steps);
+    emitterOf[i] = static_cast<unsigned short>(emitter);
+    alive[i] = true;
+    emitters[emitter].liveParticles++;
+}
+
+void ParticleSystem::advance(int i) {
+    prevX[i] = posX[i];
+    prevY[i] = posY[i];
+    posX[i] = static_cast<short>(posX[i] + velX[i]);
+    posY[i] = static_cast<short>(posY[i] + velY[i]);
+    stepsLeft[i]--;
+}
+
+bool ParticleSystem::markHit(int emitter, int target) {
+    unsigned bit = 1u << target;
+    if (emitters[emitter].hitMask & bit) return false;
+    emitters[emitter].hitMask |= bit;
+    return true;
+}
+
+// Move the last particle into slot i; an emitter with no particles left is released
+void ParticleSystem::removeAt(int i) {
+    int e = emitterOf[i];
+    if (--emitters[e].liveParticles == 0) {
+        freeEmitters[freeCount++] = static_cast<unsigned short>(e);
+    }
+
+    int last = --count;
+    if (i != last) {
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        prevX[i] = prevX[last];
+        prevY[i] = prevY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        symbols[i] = symbols[last];
+        stepsLeft[i] = stepsLeft[last];
+        emitterOf[i] = emitterOf[last];
+        alive[i] = alive[last];
+    }
+}
@@ -0,0 +1,92 @@
+// ParticleSystem.h - Fixed-capacity particle pool (shrapnel and other short effects)
+// Particles are stored as parallel arrays and removed by swapping in the last one. The
+// pool is sized when the level is loaded (reserve), so spawning, stepping and removal
+// never allocate. Each particle belongs to an emitter (one explosion) that owns a
+// bitmask of targets it has already hit.
+
+#pragma once
+
+#include "Point.h"
+#include "console.h"
+#include <vector>
+
+class ParticleSystem {
+public:
+    static const int DEFAULT_EMITTERS = 32;
+    static const int DEFAULT_PARTICLES = 256;
+
+private:
+    // Particle columns (valid for index < count)
+    std::vector<short> posX;
+    std::vector<short> posY;
+    std::vector<short> prevX;
+    std::vector<short> prevY;
+    std::vector<signed char> velX;
+    std::vector<signed char> velY;
+    std::vector<char> symbols;
+    std::vector<short> stepsLeft;
+    std::vector<unsigned short> emitterOf;
+    std::vector<bool> alive;
+    int count;
+
+    struct Emitter {
+        Point origin;
+        Color color;
+        int liveParticles;   // Released when it drops to zero
+        unsigned hitMask;    // Bit n = target n already hit
+    };
+    std::vector<Emitter> emitters;
+    std::vector<unsigned short> freeEmitters;  // Stack of unused emitter slots
+    int freeCount;
+
+    void removeAt(int i);
+
+public:
+    ParticleSystem();
+
+    void clear();
+
+    // Grow the pool to hold emitterCount emitters of particlesPerEmitter particles each
+    // (never shrinks; drops any live particles)
+    void reserve(int emitterCount, int particlesPerEmitter);
+    int getEmitterCapacity() const { return (int)emitters.size(); }
+
+    // Reserve an emitter for particleCount particles (-1 if the pool is full)
+    int addEmitter(const Point& origin, Color color, int particleCount);
+    void spawn(int emitter, int dx, int dy, char symbol, int steps);
+
+    // Particle access
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    Point getPos(int i) const { return Point(posX[i], posY[i]); }
+    Point getPrevPos(int i) const { return Point(prevX[i], prevY[i]); }
+    char getSymbol(int i) const { return symbols[i]; }
+    int getStepsLeft(int i) const { return stepsLeft[i]; }
+    int getEmitter(int i) const { return emitterOf[i]; }
+    bool isAlive(int i) const { return alive[i]; }
+
+    // Advance one cell along the particle's velocity
+    void advance(int i);
+    void kill(int i) { alive[i] = false; }
+
+    // Emitter access
+    const Point& getOrigin(int emitter) const { return emitters[emitter].origin; }
+    Color getColor(int emitter) const { return emitters[emitter].color; }
+
+    // Record a hit on target (0-31); true only the first time this emitter hits it
+    bool markHit(int emitter, int target);
+
+    // Swap-remove dead particles, calling onRemove(index) before each removal
+    template <typename OnRemove>
+    void removeDead(OnRemove onRemove) {
+        int i = 0;
+        while (i < count) {
+            if (alive[i]) {
+                i++;
+                continue;
+            }
+            onRemove(i);
+            removeAt(i);
+        }
+    }
+};
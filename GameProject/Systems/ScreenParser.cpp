@@ -6,6 +6,7 @@
 #include "Game.h"
 #include "GameConfig.h"
 #include "GameRecorder.h"
+#include "GridComponents.h"
 #include <algorithm>
 #include <iostream>
 #include <set>
@@ -31,7 +32,7 @@ ScreenParser::ScreenParser()
     legendX(-1), legendY(-1), hasLegend(false),
     player1X(2), player1Y(2), player2X(2), player2Y(18),
     hasPlayer1Start(false), hasPlayer2Start(false),
-    gateChar('0') {
+    lightLogic(SignalLogic::Or), gateChar('0') {
 }
 
 std::string ScreenParser::trim(const std::string& str) const {
@@ -237,13 +238,41 @@ bool ScreenParser::parseMetadata(const std::string& line) {
         return true;
     }
 
-    // switch 30,14 gate: 2
+    // switch 30,14 gate: 2   or   switch 30,14 gate: 2,3
     if (lower.find("switch ") == 0 && lower.find("gate:") != std::string::npos) {
         size_t coordStart = 7;
         size_t gatePos = lower.find("gate:");
         std::string coords = trim(content.substr(coordStart, gatePos - coordStart));
-        char linkedGate = trim(content.substr(gatePos + 5))[0];
-        switchGates[coords] = linkedGate;
+        std::string linkedGates;
+        for (char c : content.substr(gatePos + 5)) {
+            if (c != ',' && c != ' ' && c != '\t') linkedGates += c;
+        }
+        if (!linkedGates.empty()) switchGates[coords] = linkedGates;
+        return true;
+    }
+
+    // gate 2 logic: xor
+    if (lower.find("gate ") == 0 && lower.find("logic:") != std::string::npos) {
+        char doorChar = trim(content.substr(5))[0];
+        SignalLogic logic;
+        if (parseLogic(content.substr(lower.find("logic:") + 6), logic)) {
+            gateLogic[doorChar] = logic;
+        }
+        return true;
+    }
+
+    // light_logic: and
+    if (lower.find("light_logic:") == 0) {
+        parseLogic(content.substr(12), lightLogic);
+        return true;
+    }
+
+    // gate 30,5 door: 2
+    if (lower.find("gate ") == 0 && lower.find("door:") != std::string::npos) {
+        size_t coordStart = 5;
+        size_t doorPos = lower.find("door:");
+        std::string coords = trim(content.substr(coordStart, doorPos - coordStart));
+        gateDoors[coords] = trim(content.substr(doorPos + 5))[0];
         return true;
     }
 
@@ -266,32 +295,57 @@ bool ScreenParser::parseMetadata(const std::string& line) {
     return false;
 }
 
+// "and" / "or" / "xor" (leaves logic unchanged on anything else)
+bool ScreenParser::parseLogic(const std::string& text, SignalLogic& logic) const {
+    std::string name = toLower(trim(text));
+    if (name == "and") logic = SignalLogic::And;
+    else if (name == "or") logic = SignalLogic::Or;
+    else if (name == "xor") logic = SignalLogic::Xor;
+    else return false;
+    return true;
+}
+
 bool ScreenParser::isGateChar(char c) const {
     return c == '|' || c == '-';
 }
 
-// Detect gate bounds from visual | and - characters
+// Detect gates from visual | and - characters
+// Each connected outline becomes one gate; its door comes from a "gate x,y door:" entry
+// on any of its cells, otherwise from the screen's default gate char
 void ScreenParser::detectAndAddGates(const std::vector<std::string>& lines, GameLevel* level) {
-    int minX = GameConfig::GAME_WIDTH, minY = GameConfig::GAME_HEIGHT;
-    int maxX = 0, maxY = 0;
-    bool foundGate = false;
-
+    std::vector<Point> barCells;
     for (int y = 0; y < (int)lines.size() && y < GameConfig::GAME_HEIGHT; y++) {
         for (int x = 0; x < (int)lines[y].size() && x < GameConfig::GAME_WIDTH; x++) {
             if (isGateChar(lines[y][x])) {
-                foundGate = true;
-                if (x < minX) minX = x;
-                if (y < minY) minY = y;
-                if (x > maxX) maxX = x;
-                if (y > maxY) maxY = y;
+                barCells.push_back(Point(x, y));
             }
         }
     }
+    if (barCells.empty()) return;
+
+    GridComponents grouping;
+    for (const auto& outline : grouping.group(barCells)) {
+        int minX = GameConfig::GAME_WIDTH, minY = GameConfig::GAME_HEIGHT;
+        int maxX = 0, maxY = 0;
+        char door = gateChar;
+        bool hasOwnDoor = false;
+
+        for (const auto& p : outline) {
+            if (p.getX() < minX) minX = p.getX();
+            if (p.getY() < minY) minY = p.getY();
+            if (p.getX() > maxX) maxX = p.getX();
+            if (p.getY() > maxY) maxY = p.getY();
+
+            if (!hasOwnDoor && !gateDoors.empty()) {
+                auto it = gateDoors.find(std::to_string(p.getX()) + "," + std::to_string(p.getY()));
+                if (it != gateDoors.end()) {
+                    door = it->second;
+                    hasOwnDoor = true;
+                }
+            }
+        }
 
-    if (foundGate) {
-        int width = maxX - minX + 1;
-        int height = maxY - minY + 1;
-        level->addGate(minX, minY, width, height, gateChar);
+        level->addGate(minX, minY, maxX - minX + 1, maxY - minY + 1, door);
     }
 }
 
@@ -332,12 +386,12 @@ void ScreenParser::parseVisualLine(const std::string& line, int y, GameLevel* le
         case '\\':
         case '/': {
             std::string coordKey = std::to_string(x) + "," + std::to_string(y);
-            char linkedGate = gateChar;
+            std::string linkedGates(1, gateChar);
             auto it = switchGates.find(coordKey);
             if (it != switchGates.end()) {
-                linkedGate = it->second;
+                linkedGates = it->second;
             }
-            level->addSwitch(x, y, linkedGate, c == '/');
+            level->addSwitch(x, y, linkedGates, c == '/');
             break;
         }
 
@@ -381,6 +435,10 @@ void ScreenParser::parseVisualLine(const std::string& line, int y, GameLevel* le
             level->addSpringCell(x, y);
             break;
 
+        case '%':
+            level->addBrush(x, y);
+            break;
+
         case '|':
         case '-':
             // Gate bars handled by detectAndAddGates
@@ -414,6 +472,9 @@ std::unique_ptr<GameLevel> ScreenParser::loadFromFile(const std::string& filenam
     gateChar = '0';
     doorTargets.clear();
     switchGates.clear();
+    gateDoors.clear();
+    gateLogic.clear();
+    lightLogic = SignalLogic::Or;
     riddleIds.clear();
 
     std::vector<std::string> visualLines;
@@ -438,6 +499,10 @@ std::unique_ptr<GameLevel> ScreenParser::loadFromFile(const std::string& filenam
     auto level = std::make_unique<GameLevel>(levelNumber);
     level->setDarkRoom(darkRoom);
     level->setTorchRadius(torchRadius);
+    level->setLightLogic(lightLogic);
+    for (const auto& entry : gateLogic) {
+        level->setGateLogic(entry.first, entry.second);
+    }
 
     // Second pass: create objects from visual data
     for (int y = 0; y < (int)visualLines.size() && y < GameConfig::GAME_HEIGHT; y++) {
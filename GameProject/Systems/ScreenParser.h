@@ -33,15 +33,18 @@
 //   !       = Torch
 //   S       = Light switch
 //   0-9     = Door number (connects to screen with that number)
-//   |, -    = Gate bars (auto-detected as connected region)
+//   |, -    = Gate bars (each connected outline is its own gate)
 //   D       = Dark room marker
 //   B       = Bomb (collectible, explodes after 5 cycles when dropped)
 //   *       = Obstacle (pushable, adjacent * form one obstacle)
 //   #       = Spring (launches player, must be adjacent to wall)
 //
 // METADATA (comments at top of file):
-//   # gate <char>                  - which door the gate blocks
-//   # switch <x>,<y> gate: <char>  - link switch to gate
+//   # gate <char>                  - which door gates block by default
+//   # gate <x>,<y> door: <char>    - door blocked by the gate whose bars cover x,y
+//   # switch <x>,<y> gate: <chars> - link switch to one or more gates (e.g. gate: 2,3)
+//   # gate <char> logic: and|or|xor - how the gate's switches combine (default and)
+//   # light_logic: and|or|xor      - how light switches combine (default or)
 //
 // RIDDLES FILE (riddles.txt):
 //   [riddle_id]
@@ -82,11 +85,16 @@ private:
     // Door targets: door_char -> target_level
     std::map<char, int> doorTargets;
 
-    // Switch linkages: "x,y" -> gate_char
-    std::map<std::string, char> switchGates;
+    // Switch linkages: "x,y" -> gate chars
+    std::map<std::string, std::string> switchGates;
+
+    // Switch logic per gate door char, and for the light switches
+    std::map<char, SignalLogic> gateLogic;
+    SignalLogic lightLogic;
 
     // Gate door numbers (which door char the gate blocks)
-    char gateChar;
+    char gateChar;                               // Default for gates without their own entry
+    std::map<std::string, char> gateDoors;       // "x,y" on a gate outline -> door char
 
     // Riddle positions: "x,y" -> riddle_id
     std::map<std::string, std::string> riddleIds;
@@ -106,6 +114,7 @@ private:
     std::string trim(const std::string& str) const;
     std::string toLower(const std::string& str) const;
     bool parseMetadata(const std::string& line);
+    bool parseLogic(const std::string& text, SignalLogic& logic) const;
     void parseVisualLine(const std::string& line, int y, GameLevel* level);
     void detectAndAddGates(const std::vector<std::string>& lines, GameLevel* level);
     bool isGateChar(char c) const;
@@ -0,0 +1,64 @@
+// SignalGraph.cpp - Counter-based switch logic (AND / OR / XOR consumers)
+
+#include "SignalGraph.h"
+
+void SignalGraph::clear() {
+    inputs.clear();
+    consumers.clear();
+}
+
+int SignalGraph::addInput(bool on) {
+    inputs.push_back(Input(on));
+    return (int)inputs.size() - 1;
+}
+
+int SignalGraph::addConsumer(SignalLogic logic) {
+    consumers.push_back(Consumer(logic));
+    return (int)consumers.size() - 1;
+}
+
+void SignalGraph::connect(int input, int consumer) {
+    Input& in = inputs[input];
+    in.consumers.push_back(consumer);
+    if (in.active) {
+        consumers[consumer].liveInputs++;
+        if (in.on) consumers[consumer].onInputs++;
+    }
+}
+
+void SignalGraph::setLogic(int consumer, SignalLogic logic) {
+    consumers[consumer].logic = logic;
+}
+
+// Add (sign = 1) or remove (sign = -1) an input's contribution to its consumers
+void SignalGraph::apply(const Input& input, int sign) {
+    if (!input.active) return;
+    for (int c : input.consumers) {
+        consumers[c].liveInputs += sign;
+        if (input.on) consumers[c].onInputs += sign;
+    }
+}
+
+void SignalGraph::setInput(int input, bool active, bool on) {
+    Input& in = inputs[input];
+    if (in.active == active && in.on == on) return;
+    apply(in, -1);
+    in.active = active;
+    in.on = on;
+    apply(in, 1);
+}
+
+bool SignalGraph::isSatisfied(int consumer) const {
+    if (consumer < 0 || consumer >= (int)consumers.size()) return false;
+    const Consumer& c = consumers[consumer];
+    switch (c.logic) {
+    case SignalLogic::And: return c.liveInputs > 0 && c.onInputs == c.liveInputs;
+    case SignalLogic::Or:  return c.onInputs > 0;
+    case SignalLogic::Xor: return (c.onInputs % 2) == 1;
+    }
+    return false;
+}
+
+const std::vector<int>& SignalGraph::getConsumers(int input) const {
+    return inputs[input].consumers;
+}
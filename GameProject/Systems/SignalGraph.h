@@ -0,0 +1,55 @@
+// SignalGraph.h - Switch wiring compiled at level load
+// Inputs (switches, light switches) feed consumers (gate groups, room light). Each consumer
+// counts its live and ON inputs, so flipping an input costs O(its fan-out) and asking
+// whether a consumer is satisfied is O(1) - nothing is rescanned per frame.
+
+#pragma once
+
+#include <vector>
+
+// How a consumer combines its inputs
+enum class SignalLogic {
+    And,  // every live input ON (and at least one input)
+    Or,   // any input ON
+    Xor   // odd number of inputs ON
+};
+
+class SignalGraph {
+private:
+    struct Input {
+        bool active;  // Destroyed inputs stop counting
+        bool on;
+        std::vector<int> consumers;
+
+        Input(bool isOn) : active(true), on(isOn) {}
+    };
+
+    struct Consumer {
+        SignalLogic logic;
+        int liveInputs;
+        int onInputs;
+
+        Consumer(SignalLogic l) : logic(l), liveInputs(0), onInputs(0) {}
+    };
+
+    std::vector<Input> inputs;
+    std::vector<Consumer> consumers;
+
+    void apply(const Input& input, int sign);
+
+public:
+    void clear();
+
+    // Build
+    int addInput(bool on);
+    int addConsumer(SignalLogic logic);
+    void connect(int input, int consumer);
+    void setLogic(int consumer, SignalLogic logic);
+
+    // Update one input (destroyed inputs pass active = false)
+    void setInput(int input, bool active, bool on);
+
+    // Query
+    bool isSatisfied(int consumer) const;
+    const std::vector<int>& getConsumers(int input) const;
+};
@@ -1,4 +1,4 @@
-// MessageDisplay.cpp - Temporary message display with auto-clear timer
+// MessageDisplay.cpp - Temporary message display, cleared by a timed sequence
 
 #include "MessageDisplay.h"
 #include "GameConfig.h"
@@ -14,35 +14,38 @@ void MessageDisplay::setSilentMode(bool silent) {
 
 // Constructor
 MessageDisplay::MessageDisplay() 
-    : timer(0), displayY(GameConfig::GAME_HEIGHT + 1) {}
+    : displayY(GameConfig::GAME_HEIGHT + 1), sequencer(nullptr) {}
 
 // Set display position
 void MessageDisplay::setDisplayY(int y) {
     displayY = y;
 }
 
+void MessageDisplay::setSequencer(Sequencer* seq) {
+    sequencer = seq;
+}
+
 // Show message
+// A newer message replaces the old one and its timeout
 void MessageDisplay::show(const std::string& msg, int duration) {
     message = msg;
-    timer = duration;
+    timeout = sequencer ? sequencer->start(expireAfter(duration)) : Sequence();
 }
 
-// Clear message
-void MessageDisplay::clear() {
+Sequence MessageDisplay::expireAfter(int duration) {
+    co_await cycles(duration);
     message.clear();
-    timer = 0;
 }
 
-// Update timer
-void MessageDisplay::update() {
-    if (timer > 0) {
-        timer--;
-    }
+// Clear message
+void MessageDisplay::clear() {
+    message.clear();
+    timeout = Sequence();
 }
 
 // Check if active
 bool MessageDisplay::isActive() const {
-    return timer > 0 && !message.empty();
+    return !message.empty();
 }
 
 // Getters
@@ -50,10 +53,6 @@ const std::string& MessageDisplay::getMessage() const {
     return message;
 }
 
-int MessageDisplay::getTimer() const {
-    return timer;
-}
-
 // Draw message
 void MessageDisplay::draw() const {
     if (silentMode) return;
@@ -2,37 +2,39 @@
 
 #pragma once
 
+#include "Sequence.h"
 #include <string>
 
 class MessageDisplay {
 private:
     std::string message;
-    int timer;
     int displayY;
     static bool silentMode;
 
+    // Timeout runs on the level's tick; without a sequencer messages stay until replaced
+    Sequencer* sequencer;
+    Sequence timeout;
+    Sequence expireAfter(int duration);
+
 public:
     MessageDisplay();
 
     // Setup
     void setDisplayY(int y);
+    void setSequencer(Sequencer* seq);
     static void setSilentMode(bool silent);
 
-    // Show message with duration
+    // Show message for a number of cycles
     void show(const std::string& msg, int duration = 30);
 
     // Clear immediately
     void clear();
 
-    // Update timer (call once per frame)
-    void update();
-
     // Check if active
     bool isActive() const;
 
     // Getters
     const std::string& getMessage() const;
-    int getTimer() const;
 
     // Draw
     void draw() const;